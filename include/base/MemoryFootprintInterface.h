@@ -0,0 +1,39 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+/**
+ * Interface for problems which report the memory held by their coupling data structures,
+ * so that the memory used on each rank can be monitored as the problem size grows.
+ */
+class MemoryFootprintInterface
+{
+public:
+  virtual ~MemoryFootprintInterface() = default;
+
+  /**
+   * Get the (estimated) memory held on this rank by each coupling data structure
+   * @param[out] bytes bytes held by each data structure, indexed by name
+   */
+  virtual void memoryFootprint(std::map<std::string, std::size_t> & bytes) const = 0;
+};
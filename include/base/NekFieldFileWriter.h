@@ -0,0 +1,131 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "nekrs.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief Writes NekRS field files on a background thread
+ *
+ * On an output step, the velocity, pressure, and passive scalars are copied from the
+ * device into one of a fixed number of host staging slots, and the slot is handed to a
+ * background thread which performs the (collective) field file write through the
+ * Nek5000 backend. The time loop therefore only pays for a device-to-host copy, unless
+ * all of the slots are still waiting to be written, in which case it blocks until a slot
+ * frees up (which bounds the memory used for staging).
+ *
+ * Because the writer fills the Nek5000 solution arrays before writing, any other use
+ * of the Nek5000 backend on the main thread must hold the lock returned by lockBackend().
+ */
+class NekFieldFileWriter
+{
+public:
+  /**
+   * @param[in] n_slots number of staging slots, i.e. the maximum number of pending writes
+   * @param[in] prefix prefix to apply to the field files, or empty for NekRS's usual names
+   */
+  NekFieldFileWriter(const unsigned int n_slots, const std::string & prefix);
+
+  /// Writes any pending field files before stopping the background thread
+  ~NekFieldFileWriter();
+
+  /**
+   * Snapshot the current NekRS solution and queue it to be written
+   * @param[in] time nondimensional time to write in the field file
+   */
+  void write(const double time);
+
+  /// Block until all queued field files have been written
+  void flush();
+
+  /**
+   * Acquire exclusive use of the Nek5000 backend
+   * @return lock, released when it goes out of scope
+   */
+  std::unique_lock<std::mutex> lockBackend() { return std::unique_lock<std::mutex>(_backend_mutex); }
+
+  /**
+   * Number of bytes held on the host for the staging slots
+   * @return bytes
+   */
+  std::size_t bytes() const;
+
+protected:
+  /// Loop run by the background thread, writing queued slots until told to stop
+  void run();
+
+  /// Host copy of the solution to be written
+  struct Slot
+  {
+    /// nondimensional time
+    double time;
+
+    /// velocity
+    occa::memory o_U;
+
+    /// pressure
+    occa::memory o_P;
+
+    /// passive scalars
+    occa::memory o_S;
+  };
+
+  /// Prefix to apply to the field files
+  const std::string _prefix;
+
+  /// Number of passive scalars
+  int _n_scalars;
+
+  /// Staging slots
+  std::vector<Slot> _slots;
+
+  /// Slots which are free to receive a new snapshot
+  std::deque<unsigned int> _free;
+
+  /// Slots waiting to be written, in order
+  std::deque<unsigned int> _pending;
+
+  /// Whether the background thread is currently writing a slot
+  bool _writing = false;
+
+  /// Whether the background thread should exit once the pending slots are written
+  bool _stop = false;
+
+  /// Protects the slot queues and flags
+  std::mutex _mutex;
+
+  /// Signaled when a slot is queued or the writer is told to stop
+  std::condition_variable _queued;
+
+  /// Signaled when a slot has been written
+  std::condition_variable _written;
+
+  /// Serializes use of the Nek5000 backend between the main and background threads
+  std::mutex _backend_mutex;
+
+  /// Background thread performing the writes
+  std::thread _thread;
+};
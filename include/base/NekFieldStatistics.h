@@ -0,0 +1,134 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "CardinalEnums.h"
+#include "DataIO.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace statistic
+{
+/// Running statistics accumulated for a NekRS field
+enum StatisticEnum
+{
+  mean,
+  rms,
+  min,
+  max
+};
+} // namespace statistic
+
+/**
+ * Statistics accumulated by NekFieldStatistics, which are declared as restartable data so
+ * that the accumulation continues across a restart, and so that restoring a sub-application
+ * (such as on each fixed point iteration) also restores the statistics
+ */
+struct NekFieldStatisticsState
+{
+  /// Accumulated time
+  double time = 0.0;
+
+  /// Running mean, indexed by field and then GLL point
+  std::vector<std::vector<double>> mean;
+
+  /// Running time-weighted sum of the squared deviations from the mean
+  std::vector<std::vector<double>> m2;
+
+  /// Running minimum
+  std::vector<std::vector<double>> min;
+
+  /// Running maximum
+  std::vector<std::vector<double>> max;
+};
+
+template <>
+void dataStore(std::ostream & stream, NekFieldStatisticsState & state, void * context);
+
+template <>
+void dataLoad(std::istream & stream, NekFieldStatisticsState & state, void * context);
+
+/**
+ * \brief In-situ running statistics of NekRS solution fields
+ *
+ * For each selected field, this accumulates the time-weighted mean and variance, and the
+ * minimum and maximum, at each of the rank-local GLL points. Statistics are updated from
+ * the host copy of the NekRS solution once per time step, so that time-averaged quantities
+ * can be obtained without writing (and post-processing) many field files. The variance is
+ * accumulated about the running mean with West's weighted form of Welford's algorithm,
+ * which does not lose precision when the fluctuations are small relative to the mean.
+ * All values are stored in NekRS's (possibly nondimensional) units.
+ */
+class NekFieldStatistics
+{
+public:
+  /**
+   * @param[in] fields fields for which to accumulate statistics
+   * @param[in] n_points number of rank-local GLL points
+   * @param[in] state accumulated statistics, which may hold statistics loaded from a restart
+   */
+  NekFieldStatistics(const std::vector<field::NekFieldEnum> & fields, const int n_points,
+    NekFieldStatisticsState & state);
+
+  /**
+   * Accumulate the current NekRS solution, weighted by the time step
+   * @param[in] dt time step size over which the current solution is representative
+   */
+  void update(const double dt);
+
+  /**
+   * Get a statistic at a GLL point; the RMS is of the fluctuation about the mean. This
+   * may only be called once some statistics have been accumulated.
+   * @param[in] i index of the field, in the order given to the constructor
+   * @param[in] type statistic
+   * @param[in] id rank-local GLL index
+   * @return statistic
+   */
+  double value(const unsigned int i, const statistic::StatisticEnum & type, const int id) const;
+
+  /**
+   * Fields for which statistics are accumulated
+   * @return fields
+   */
+  const std::vector<field::NekFieldEnum> & fields() const { return _fields; }
+
+  /**
+   * Total time over which statistics have been accumulated
+   * @return accumulated time
+   */
+  double time() const { return _state.time; }
+
+  /**
+   * Number of bytes held for the accumulated statistics
+   * @return bytes
+   */
+  std::size_t bytes() const;
+
+protected:
+  /// Fields for which statistics are accumulated
+  const std::vector<field::NekFieldEnum> _fields;
+
+  /// Number of rank-local GLL points
+  const int _n_points;
+
+  /// Accumulated statistics
+  NekFieldStatisticsState & _state;
+};
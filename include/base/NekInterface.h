@@ -21,6 +21,7 @@
 #include "CardinalEnums.h"
 #include "MooseTypes.h"
 #include "NekBoundaryCoupling.h"
+#include "NekBoundaryPoints.h"
 #include "NekVolumeCoupling.h"
 #include "nekrs.hpp"
 #include "bcMap.hpp"
@@ -71,6 +72,18 @@ void buildOnly(int buildOnly);
  */
 int buildOnly();
 
+/**
+ * Set the case name, i.e. the prefix of the NekRS input files
+ * @param[in] casename case name
+ */
+void casename(const std::string & casename);
+
+/**
+ * Whether the case has a Nek5000 .usr file, whose routines run in the Nek5000 backend
+ * @return whether the case has a .usr file
+ */
+bool hasUsrFile();
+
 /**
  * Interpolate a volume between NekRS's GLL points and a given-order receiving/sending mesh
  */
@@ -106,6 +119,13 @@ bool endControlTime();
  */
 bool endControlNumSteps();
 
+/**
+ * Maximum CFL number of the current NekRS velocity, evaluated on the device with the
+ * (nondimensional) time step of the most recent NekRS step
+ * @return CFL number
+ */
+double cfl();
+
 /**
  * Offset increment for indexing into multi-volume arrays for the scalar fields.
  * This assumes that all scalars are the same length as the temperature scalar.
@@ -152,6 +172,71 @@ int commRank();
  */
 int commSize();
 
+namespace comm
+{
+/// Type of collective communication issued by Cardinal on NekRS's communicator
+enum CollectiveEnum
+{
+  allreduce,
+  allgather,
+  allgatherv,
+  barrier
+};
+
+/// Number of types of collective communication
+static constexpr unsigned int n_collectives = 4;
+
+/// Cumulative counters for one type of collective communication on this rank
+struct Counter
+{
+  /// number of calls
+  long calls = 0;
+
+  /// number of bytes in the results received by this rank
+  long bytes = 0;
+
+  /// wall time spent in the calls (seconds)
+  double time = 0.0;
+};
+
+/**
+ * Record a collective communication
+ * @param[in] type type of collective
+ * @param[in] bytes number of bytes in the result received by this rank
+ * @param[in] time wall time spent in the call
+ */
+void record(const CollectiveEnum & type, const long bytes, const double time);
+
+/**
+ * Get the counters for a type of collective communication on this rank
+ * @param[in] type type of collective
+ * @return counters
+ */
+const Counter & counter(const CollectiveEnum & type);
+} // end namespace comm
+
+/**
+ * Counted MPI_Allreduce on NekRS's communicator
+ * @param[in] input rank-local data
+ * @param[out] output reduced result
+ * @param[in] count number of entries
+ * @param[in] type MPI datatype of each entry
+ * @param[in] op reduction operation
+ */
+void allreduce(const void * input, void * output, const int count, MPI_Datatype type, MPI_Op op);
+
+/**
+ * Counted MPI_Allgather on NekRS's communicator
+ * @param[in] input rank-local data
+ * @param[in] count number of entries contributed by each rank
+ * @param[out] output collected result
+ * @param[in] type MPI datatype of each entry
+ */
+void allgather(const void * input, const int count, void * output, MPI_Datatype type);
+
+/// Counted MPI_Barrier on NekRS's communicator
+void barrier();
+
 /**
  * Whether nekRS's input file indicates that the problem has a temperature variable
  * @return whether the nekRS problem includes a temperature variable
@@ -206,9 +291,48 @@ double Pr();
 /// Copy the flux from host to device
 void copyScratchToDevice();
 
+/**
+ * Copy only the given index ranges of the scratch space from host to device, for
+ * when Cardinal has only written to a subset of the scratch space
+ * @param[in] ranges [begin, end) index ranges into the scratch space
+ */
+void copyScratchToDevice(const std::vector<std::pair<int, int>> & ranges);
+
 /// Copy volume deformation of mesh from host to device for moving-mesh problems
 void copyDeformationToDevice();
 
+/**
+ * Copy volume deformation of a subset of the elements from host to device for moving-mesh
+ * problems, and refresh the host geometric factors for only those elements
+ * @param[in] ranges [begin, end) ranges of rank-local element IDs that have deformed
+ */
+void copyDeformationToDevice(const std::vector<std::pair<int, int>> & ranges);
+
+/**
+ * \brief Get the rank-local GLL points on a set of boundaries
+ *
+ * The first call for a given mesh and set of boundary IDs searches all element faces;
+ * the result is cached so that subsequent side reductions loop only over the boundary
+ * points. The order of the boundary IDs does not matter.
+ * @param[in] boundary_id nekRS boundary IDs
+ * @param[in] mesh nekRS mesh on which to find the boundary points
+ * @return boundary points
+ */
+const NekBoundaryPoints & boundaryPoints(const std::vector<int> & boundary_id, mesh_t * mesh);
+
+/**
+ * Get the rank-local GLL points on a set of boundaries of the entire NekRS mesh
+ * @param[in] boundary_id nekRS boundary IDs
+ * @return boundary points
+ */
+const NekBoundaryPoints & boundaryPoints(const std::vector<int> & boundary_id);
+
+/**
+ * Clear all cached boundary points and free their device copies; this must be done
+ * before NekRS is torn down, or if the mesh topology changes
+ */
+void clearBoundaryPoints();
+
 template <typename T>
 void allgatherv(const std::vector<int> & base_counts, const T * input, T * output, const int multiplier = 1);
 
@@ -364,6 +488,21 @@ void dimensionalizeSideIntegral(const field::NekFieldEnum & integrand, const Rea
  */
 void dimensionalizeSideIntegral(const field::NekFieldEnum & integrand, const std::vector<int> & boundary_id, double & integral);
 
+/**
+ * Dimensionalize a given integral of f weighted by the mass flux over a side, i.e. f*rho*u.n*dS
+ * @param[in] integrand field to dimensionalize
+ * @param[in] mass_flowrate dimensional mass flowrate through the side (only used for dimensionalizing temperature)
+ * @param[in] integral integral to dimensionalize
+ */
+void dimensionalizeSideMassFluxWeightedIntegral(const field::NekFieldEnum & integrand, const Real & mass_flowrate, double & integral);
+
+/**
+ * Dimensionalize a pointwise value of a field, such as an extreme value
+ * @param[in] field field to dimensionalize
+ * @param[in] value value to dimensionalize
+ */
+void dimensionalizePointValue(const field::NekFieldEnum & field, double & value);
+
 /**
  * Compute the volume integral of a given integrand over the entire scalar mesh
  * @param[in] integrand field to integrate
@@ -388,26 +527,22 @@ double massFlowrate(const std::vector<int> & boundary_id);
 double sideMassFluxWeightedIntegral(const std::vector<int> & boundary_id, const field::NekFieldEnum & integrand);
 
 /**
- * Compute the heat flux over a set of boundary IDs
+ * Compute the heat flux over a set of boundary IDs. The normal temperature gradient is
+ * evaluated on the device only at the boundary GLL points, using the (possibly spatially
+ * varying) conductivity held by nekRS.
  * @param[in] boundary_id nekRS boundary IDs for which to perform the integral
  * @return heat flux area integral
  */
 double heatFluxIntegral(const std::vector<int> & boundary_id);
 
 /**
- * Limit the temperature in nekRS to within the range of [min_T, max_T]
+ * Limit the temperature in nekRS to within the range of [min_T, max_T]; this is
+ * performed on the device, and the host copy of the temperature is not updated
  * @param[in] min_T minimum temperature allowable in nekRS
  * @param[in] max_T maximum temperature allowable in nekRS
+ * @return number of GLL points (across all ranks) at which the temperature was limited
  */
-void limitTemperature(const double * min_T, const double * max_T);
-
-/**
- * Compute the gradient of a volume field
- * @param[in] offset in the gradient field for each component (grad_x, grad_y, or grad_z)
- * @param[in] f field to compute the gradient of
- * @param[out] grad_f gradient of field
- */
-void gradient(const int offset, const double * f, double * grad_f);
+long limitTemperature(const double * min_T, const double * max_T);
 
 /**
  * Find the minimum of a given field over the entire nekRS domain
@@ -725,9 +860,16 @@ void allgatherv(const std::vector<int> & base_counts, const T * input, T * outpu
   int * displacement = (int *) calloc(commSize(), sizeof(int));
   displacementAndCounts(base_counts, recvCounts, displacement, multiplier);
 
+  double start = MPI_Wtime();
   MPI_Allgatherv(input, recvCounts[commRank()], resolveType<T>(), output,
     (const int*)recvCounts, (const int*)displacement, resolveType<T>(), platform->comm.mpiComm);
 
+  long n_received = 0;
+  for (int i = 0; i < commSize(); ++i)
+    n_received += recvCounts[i];
+
+  comm::record(comm::allgatherv, n_received * sizeof(T), MPI_Wtime() - start);
+
   free(recvCounts);
   free(displacement);
 }
@@ -21,6 +21,7 @@
 #include "NekRSProblemBase.h"
 #include "NekTimeStepper.h"
 #include "NekRSMesh.h"
+#include "NekScratchHistory.h"
 #include "Transient.h"
 
 #include <memory>
@@ -108,6 +109,19 @@ public:
 
   virtual bool movingMesh() const override { return _moving_mesh; }
 
+  /**
+   * Get the memory held on this rank by the coupling data structures, including
+   * the serialized auxiliary solution
+   * @param[out] bytes bytes held by each data structure, indexed by name
+   */
+  virtual void memoryFootprint(std::map<std::string, std::size_t> & bytes) const override;
+
+  /**
+   * Number of GLL points at which the temperature was limited on the most recent time step
+   * @return number of limited points
+   */
+  long nLimitedTemperaturePoints() const { return _n_limited_temperature_points; }
+
 protected:
   virtual void addTemperatureVariable() override { return; }
 
@@ -126,6 +140,25 @@ protected:
   /// Whether a heat source will be applied to NekRS from MOOSE
   const bool & _has_heat_source;
 
+  /**
+   * Tolerance on the change in nodal displacement beneath which an element is not re-sent to
+   * NekRS, if only sending the deformation of elements that have moved
+   */
+  const Real * _deformation_tolerance = nullptr;
+
+  /**
+   * \brief Whether to interpolate the incoming data in time between synchronizations
+   *
+   * When only synchronizing on the master application's time steps (with 'minimize_transfers_in'),
+   * the incoming heat flux and/or heat source would otherwise be held fixed at the value from
+   * the end of the master application's step over all of NekRS's subcycled steps. Instead, this
+   * interpolates linearly in time between the two most recently received states.
+   */
+  const bool & _interpolate_transfers_in;
+
+  /// Host copy of the incoming states used for interpolating the transfers in time
+  NekScratchState & _scratch_state;
+
   /**
    * \brief Total surface-integrated flux coming from the coupled MOOSE app.
    *
@@ -154,6 +187,9 @@ protected:
   /// Postprocessor to limit the maximum temperature
   const PostprocessorValue * _max_T = nullptr;
 
+  /// Number of GLL points at which the temperature was limited on the most recent time step
+  long _n_limited_temperature_points = 0;
+
   /// nekRS temperature interpolated onto the data transfer mesh
   double * _T = nullptr;
 
@@ -195,4 +231,19 @@ protected:
 
   /// flag to indicate whether this is the first pass to serialize the solution
   static bool _first;
+
+  /// Rank-local [begin, end) index ranges of the scratch space written by Cardinal
+  std::vector<std::pair<int, int>> _scratch_ranges;
+
+  /// Nodal displacements most recently sent to NekRS for each element, if sending deformation incrementally
+  std::vector<double> _sent_displacement;
+
+  /// [begin, end) ranges of rank-local element IDs deformed in the most recent deformation transfer
+  std::vector<std::pair<int, int>> _deformed_elements;
+
+  /// Number of elements (across all ranks) deformed in the most recent deformation transfer
+  int _n_deformed_elements = 0;
+
+  /// Two most recent incoming states of the scratch space, if interpolating the transfers in time
+  std::unique_ptr<NekScratchHistory> _scratch_history;
 };
@@ -21,8 +21,13 @@
 #include "ExternalProblem.h"
 #include "NekTimeStepper.h"
 #include "NekRSMesh.h"
+#include "NekReductionEngine.h"
+#include "NekFieldFileWriter.h"
+#include "NekFieldStatistics.h"
+#include "MemoryFootprintInterface.h"
 #include "Transient.h"
 
+#include <functional>
 #include <memory>
 
 /**
@@ -32,7 +37,7 @@
  * - specifying nondimensional scales
  * - running a single time step of NekRS
  */
-class NekRSProblemBase : public ExternalProblem
+class NekRSProblemBase : public ExternalProblem, public MemoryFootprintInterface
 {
 public:
   NekRSProblemBase(const InputParameters & params);
@@ -98,6 +103,12 @@ public:
    */
   double L_ref() const { return _L_ref; }
 
+  /**
+   * Get the engine shared by the Nek postprocessors to evaluate their reductions together
+   * @return reduction engine
+   */
+  NekReductionEngine & reductionEngine() const { return *_reduction_engine; }
+
 protected:
   /**
    * Write into the NekRS solution space; for setting a mesh position in terms of a
@@ -112,6 +123,16 @@ protected:
   void writeVolumeSolution(const int elem_id, const field::NekWriteEnum & field, double * T,
     const std::vector<double> * add = nullptr);
 
+  /**
+   * Write into the NekRS solution space only at the GLL points on the faces of a volume
+   * element that lie on the coupling boundaries; this is used for fields like the heat flux,
+   * which are only read by NekRS on the boundaries even when coupling through the volume.
+   * @param[in] elem_id element ID
+   * @param[in] field field to write
+   * @param[in] T solution values to write for the field for the given element
+   */
+  void writeBoundarySolution(const int elem_id, const field::NekWriteEnum & field, double * T);
+
   /**
    * Interpolate the nekRS volume solution onto the volume data transfer mesh
    * @param[in] f field to interpolate
@@ -119,6 +140,16 @@ protected:
    */
   void volumeSolution(const field::NekFieldEnum & f, double * T);
 
+  /**
+   * Interpolate a quantity defined on the nekRS GLL points onto the volume data transfer mesh
+   * @param[in] field field used to dimensionalize the quantity
+   * @param[in] f value of the (nondimensional) quantity at a rank-local GLL index
+   * @param[out] T interpolated volume value
+   * @param[in] add_reference whether to add the reference temperature for temperatures
+   */
+  void volumeSolution(const field::NekFieldEnum & field, const std::function<double(int)> & f,
+    double * T, const bool add_reference = true);
+
   /**
    * Interpolate the nekRS boundary solution onto the boundary data transfer mesh
    * @param[in] f field to interpolate
@@ -126,6 +157,16 @@ protected:
    */
   void boundarySolution(const field::NekFieldEnum & f, double * T);
 
+  /**
+   * Interpolate a quantity defined on the nekRS GLL points onto the boundary data transfer mesh
+   * @param[in] field field used to dimensionalize the quantity
+   * @param[in] f value of the (nondimensional) quantity at a rank-local GLL index
+   * @param[out] T interpolated boundary value
+   * @param[in] add_reference whether to add the reference temperature for temperatures
+   */
+  void boundarySolution(const field::NekFieldEnum & field, const std::function<double(int)> & f,
+    double * T, const bool add_reference = true);
+
   /// Initialize interpolation matrices for transfers in/out of nekRS
   void initializeInterpolationMatrices();
 
@@ -136,6 +177,13 @@ protected:
    */
   virtual void fillAuxVariable(const unsigned int var_number, const double * value);
 
+  /**
+   * Get the memory held on this rank by the mesh mirror, the boundary and volume
+   * coupling data, and the buffers of nekRS solution data
+   * @param[out] bytes bytes held by each data structure, indexed by name
+   */
+  virtual void memoryFootprint(std::map<std::string, std::size_t> & bytes) const override;
+
   /**
    * Extract user-specified parts of the NekRS CFD solution onto the mesh mirror
    */
@@ -161,6 +209,12 @@ protected:
    */
   std::string fieldFilePrefix(const int & number) const;
 
+  /**
+   * Write a NekRS field file, either directly or by queuing it with the background writer
+   * @param[in] time dimensional time to write in the field file
+   */
+  void writeFieldFile(const Real & time);
+
   /// Whether the nekRS solution is performed in nondimensional scales
   const bool & _nondimensional;
 
@@ -227,6 +281,12 @@ protected:
   /// Whether to turn off all field file writing
   const bool & _disable_fld_file_output;
 
+  /**
+   * Whether to write field files on a background thread, so that the time loop only
+   * pays for a copy of the solution into a staging buffer on output steps
+   */
+  const bool & _asynchronous_fld_output;
+
   /**
    * \brief Whether to only send data to nekRS on the multiapp synchronization steps
    *
@@ -327,6 +387,27 @@ protected:
   /// NekRS solution fields to output to the mesh mirror
   const MultiMooseEnum * _outputs = nullptr;
 
+  /// NekRS solution fields for which to accumulate in-situ statistics
+  const MultiMooseEnum * _statistics = nullptr;
+
+  /// Time after which to begin accumulating statistics
+  const Real & _statistics_start_time;
+
+  /// Accumulated statistics of the NekRS solution, restored on restart
+  NekFieldStatisticsState & _statistics_state;
+
+  /// Running statistics of the NekRS solution, if requested
+  std::unique_ptr<NekFieldStatistics> _field_statistics;
+
+  /// Names of the external variables holding statistics
+  std::vector<std::string> _statistics_var_names;
+
+  /// Numeric identifiers for the external variables holding statistics
+  std::vector<unsigned int> _statistics_vars;
+
+  /// Field index (into the fields of _field_statistics) and statistic held by each statistics variable
+  std::vector<std::pair<unsigned int, statistic::StatisticEnum>> _statistics_var_types;
+
   /// Names of external variables when extracting the NekRS solution
   std::vector<std::string> _var_names;
 
@@ -350,4 +431,10 @@ protected:
 
   /// Vandermonde interpolation matrix (for incoming transfers)
   double * _interpolation_incoming = nullptr;
+
+  /// Shared evaluation of the reductions requested by Nek postprocessors
+  std::unique_ptr<NekReductionEngine> _reduction_engine;
+
+  /// Background writer for field files, if writing asynchronously
+  std::unique_ptr<NekFieldFileWriter> _fld_writer;
 };
@@ -0,0 +1,132 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "CardinalEnums.h"
+
+#include <mpi.h>
+#include <vector>
+
+namespace reduction
+{
+/// Type of reduction to perform over a set of NekRS GLL points
+enum ReductionEnum
+{
+  integral,
+  mass_flux_weighted_integral,
+  max,
+  min
+};
+} // namespace reduction
+
+/**
+ * \brief Shared evaluation of the reductions requested by the Nek postprocessors
+ *
+ * Rather than each postprocessor sweeping over the NekRS solution arrays and calling
+ * its own MPI_Allreduce, postprocessors register their reductions with this object
+ * (usually from their constructors). The first time any value is requested after the
+ * NekRS solution changes, all registered reductions are evaluated together with one
+ * pass over each distinct point set (the volume, or a set of boundary IDs) and a
+ * single batched MPI_Allreduce. All other requests until the next invalidation are
+ * served from the stored results. Like nekrs::massFlowrate, the mass flux weighted
+ * integrals assume a constant density.
+ */
+class NekReductionEngine
+{
+public:
+  NekReductionEngine();
+
+  ~NekReductionEngine();
+
+  /**
+   * Register a reduction; identical requests share the same storage
+   * @param[in] boundary NekRS boundary IDs over which to reduce, or empty for the whole volume
+   * @param[in] type type of reduction
+   * @param[in] field field to reduce (cannot be 'velocity_component')
+   * @return index used to retrieve the reduced value
+   */
+  unsigned int add(const std::vector<int> & boundary, const reduction::ReductionEnum & type,
+    const field::NekFieldEnum & field);
+
+  /**
+   * Get the dimensional value of a registered reduction, evaluating all registered
+   * reductions first if the NekRS solution has changed since the last evaluation
+   * @param[in] index index returned by add()
+   * @return dimensional reduced value
+   */
+  double value(const unsigned int index);
+
+  /// Mark the stored values as stale, such as after a NekRS time step or mesh motion
+  void invalidate() { _dirty = true; }
+
+protected:
+  /// Evaluate all registered reductions with one pass per point set and one collective
+  void compute();
+
+  /**
+   * Find (or add) a point set
+   * @param[in] boundary boundary IDs, or empty for the volume
+   * @return index of the point set
+   */
+  unsigned int pointSet(const std::vector<int> & boundary);
+
+  /**
+   * Find (or add) a reduction, without adding its dependencies
+   * @param[in] set point set index
+   * @param[in] type type of reduction
+   * @param[in] field field to reduce
+   * @return index of the reduction
+   */
+  unsigned int find(const unsigned int set, const reduction::ReductionEnum & type,
+    const field::NekFieldEnum & field);
+
+  /// A single reduction registered with the engine
+  struct Reduction
+  {
+    /// point set index
+    unsigned int set;
+
+    /// reduction type
+    reduction::ReductionEnum type;
+
+    /// reduced field
+    field::NekFieldEnum field;
+
+    /// reduction needed to dimensionalize the temperature, i.e. area/volume or mass flowrate
+    int dependency;
+  };
+
+  /// Point sets, as sorted boundary IDs (empty for the volume)
+  std::vector<std::vector<int>> _sets;
+
+  /// Registered reductions
+  std::vector<Reduction> _reductions;
+
+  /// Dimensional reduced values
+  std::vector<double> _values;
+
+  /// Whether the stored values are stale
+  bool _dirty = true;
+
+  /// Paired (value, is_max) datatype for the batched reduction
+  MPI_Datatype _pair_type;
+
+  /// Sum-or-max operation acting on the paired datatype
+  MPI_Op _sum_or_max;
+};
@@ -0,0 +1,126 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "nekrs.hpp"
+#include "DataIO.h"
+
+#include <utility>
+#include <vector>
+
+/**
+ * Host copy of the states saved by NekScratchHistory, which is declared as restartable
+ * data so that the interpolation continues across a restart, and so that restoring a
+ * sub-application (such as on each fixed point iteration) also restores the history
+ */
+struct NekScratchState
+{
+  /// Previous state, packed over the saved ranges of the scratch space
+  std::vector<dfloat> previous;
+
+  /// Most recent state, packed over the saved ranges of the scratch space
+  std::vector<dfloat> current;
+
+  /// Time at which the previous state applies
+  double previous_time = 0.0;
+
+  /// Time at which the most recent state applies
+  double current_time = 0.0;
+
+  /// Number of states saved so far (up to two)
+  unsigned int n_states = 0;
+
+  /// Number of calls to save, used to detect that the state was restored
+  unsigned int n_saves = 0;
+};
+
+template <>
+void dataStore(std::ostream & stream, NekScratchState & state, void * context);
+
+template <>
+void dataLoad(std::istream & stream, NekScratchState & state, void * context);
+
+/**
+ * \brief Recent states of the scratch space written by Cardinal, kept on the device
+ *
+ * The heat flux and/or heat source sent to NekRS on each synchronization are saved
+ * (over only the ranges of the scratch space that Cardinal writes) as the newest state,
+ * time-stamped with the time that the data applies at. Between synchronizations, the
+ * scratch space on the device is then set to a linear interpolation between the two most
+ * recent states, with a device kernel so that no host work or host-to-device copy is
+ * needed on the subcycled NekRS time steps.
+ *
+ * Saving again at the time of the newest state (such as when a master time step is
+ * repeated) replaces the newest state, while saving at an earlier time discards the
+ * history. The states are mirrored in a (restartable) NekScratchState, and are copied back
+ * to the device whenever that state has been restored.
+ */
+class NekScratchHistory
+{
+public:
+  /**
+   * @param[in] ranges rank-local [begin, end) index ranges of the scratch space to save
+   * @param[in] state host copy of the states, which may hold states loaded from a restart
+   */
+  NekScratchHistory(const std::vector<std::pair<int, int>> & ranges, NekScratchState & state);
+
+  /**
+   * Save the scratch space currently on the device as the newest state
+   * @param[in] time time at which the state applies
+   */
+  void save(const double time);
+
+  /**
+   * Set the scratch space on the device to a linear interpolation between the two most
+   * recent states; if fewer than two states have been saved, the scratch space is unchanged
+   * @param[in] time time at which to interpolate
+   */
+  void interpolate(const double time);
+
+  /**
+   * Number of bytes held on the device and the host for the saved states and their indices
+   * @return bytes
+   */
+  std::size_t bytes() const;
+
+protected:
+  /// Copy the host states to the device, if they have changed since the device was last updated
+  void updateDevice();
+
+  /// Number of saved entries in each state
+  dlong _n;
+
+  /// Rank-local [begin, end) index ranges of the scratch space which are saved
+  const std::vector<std::pair<int, int>> _ranges;
+
+  /// Host copy of the states
+  NekScratchState & _state;
+
+  /// Value of the number of saves when the device states were last updated
+  unsigned int _device_n_saves = 0;
+
+  /// Scratch space index of each saved entry
+  occa::memory _o_ids;
+
+  /// Previous state, packed over the ranges
+  occa::memory _o_previous;
+
+  /// Most recent state, packed over the ranges
+  occa::memory _o_current;
+};
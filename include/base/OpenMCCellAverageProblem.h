@@ -26,6 +26,7 @@
 #include "openmc/tallies/tally.h"
 #include "CardinalEnums.h"
 #include "SymmetryPointGenerator.h"
+#include "MemoryFootprintInterface.h"
 
 /**
  * Mapping of OpenMC to a collection of MOOSE elements, with temperature feedback
@@ -69,7 +70,7 @@
  *  - You will get some extra error checking at your disposal if your OpenMC geometry consists
  *    of a single coordinate level.
  */
-class OpenMCCellAverageProblem : public OpenMCProblemBase
+class OpenMCCellAverageProblem : public OpenMCProblemBase, public MemoryFootprintInterface
 {
 public:
   OpenMCCellAverageProblem(const InputParameters & params);
@@ -90,6 +91,13 @@ public:
 
   virtual bool converged() override { return true; }
 
+  /**
+   * Get the memory held on this rank by the mappings between elements and cells,
+   * the contained cells, and the serialized auxiliary solution
+   * @param[out] bytes bytes held by each data structure, indexed by name
+   */
+  virtual void memoryFootprint(std::map<std::string, std::size_t> & bytes) const override;
+
   /**
    * Whether transformations are applied to the [Mesh] points when mapping to OpenMC
    * @return whether transformations are applied
@@ -119,6 +127,22 @@ public:
     return pnt_out;
   }
 
+  /**
+   * Apply transformations and scale many points from MOOSE into the OpenMC domain
+   * @param[in] points points
+   * @param[out] transformed transformed points
+   */
+  void transformPointsToOpenMC(const std::vector<Point> & points, std::vector<Point> & transformed) const {
+    if (this->hasPointTransformations())
+      _symmetry->transformPoints(points, transformed);
+    else
+      transformed = points;
+
+    // scale points to OpenMC domain
+    for (auto & pnt : transformed)
+      pnt *= _scaling;
+  }
+
   /**
    * This class uses elem->volume() in order to normalize the fission power produced
    * by OpenMC to conserve the specified power. However, as discussed on the MOOSE
@@ -468,7 +492,7 @@ protected:
 
   /**
    * Find the OpenMC cell at a given point in space in terms of the _particle members
-   * @param[in] point point
+   * @param[in] point point, already transformed into the OpenMC domain
    * @return whether OpenMC reported an error
    */
   bool findCell(const Point & point);
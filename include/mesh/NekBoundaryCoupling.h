@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CardinalUtils.h"
+#include "MemoryFootprint.h"
 
 /// Store the geometry and parallel information related to the surface mesh coupling
 class NekBoundaryCoupling
@@ -13,6 +14,19 @@ public:
    */
   int processor_id(const int elem_id) const { return process[elem_id]; }
 
+  /**
+   * Memory held by the coupling data on this rank
+   * @return bytes
+   */
+  std::size_t bytes() const
+  {
+    return memory::heapBytes(element) +
+           memory::heapBytes(face) +
+           memory::heapBytes(boundary_id) +
+           memory::heapBytes(process) +
+           memory::heapBytes(counts);
+  }
+
   // process-local element IDS on the boundary of interest (for all ranks)
   std::vector<int> element;
 
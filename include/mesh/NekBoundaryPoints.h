@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * Flat list of the rank-local GLL points lying on a set of boundaries of the
+ * nekRS mesh, so that side reductions only touch the boundary points instead of
+ * searching every face of every element for a matching boundary ID. All entries
+ * are purely topological (offsets into nekRS arrays), so they remain valid when
+ * the mesh deforms - only the values stored in those arrays change.
+ */
+class NekBoundaryPoints
+{
+public:
+  /**
+   * Number of rank-local faces on the boundaries
+   * @return number of faces
+   */
+  int n_faces() const { return element.size(); }
+
+  /**
+   * Number of rank-local GLL points on the boundaries
+   * @return number of GLL points
+   */
+  int n_points() const { return vol_id.size(); }
+
+  // rank-local element ID for each boundary face
+  std::vector<int> element;
+
+  // element-local face ID for each boundary face
+  std::vector<int> face;
+
+  // index of the first boundary face of each rank-local element, so that the boundary
+  // faces of element 'e' are those between elem_offset[e] and elem_offset[e + 1]
+  std::vector<int> elem_offset;
+
+  // offset into the face-based arrays (like vmapM) for each GLL point, ordered
+  // face-by-face so that point 'face_index * Nfp + v' is node 'v' on face 'face_index'
+  std::vector<int> face_offset;
+
+  // volume GLL index (i.e. vmapM[face_offset]) for each GLL point
+  std::vector<int> vol_id;
+
+  // offset into the surface geometric factors (i.e. Nsgeo * face_offset) for each GLL point
+  std::vector<int> surf_offset;
+};
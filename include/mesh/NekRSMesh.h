@@ -87,6 +87,13 @@ public:
    */
   const NekVolumeCoupling & volumeCoupling() const { return _volume_coupling; }
 
+  /**
+   * Memory held on this rank by the coordinates and node orderings of the mesh mirror;
+   * this does not include the libMesh mesh itself
+   * @return bytes
+   */
+  std::size_t mirrorBytes() const;
+
   /// Add all the elements in the mesh to the MOOSE data structures
   virtual void addElems();
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CardinalUtils.h"
+#include "MemoryFootprint.h"
 
 class NekVolumeCoupling
 {
@@ -12,6 +13,19 @@ public:
    */
   int processor_id(const int elem_id) const { return process[elem_id]; }
 
+  /**
+   * Memory held by the coupling data on this rank
+   * @return bytes
+   */
+  std::size_t bytes() const
+  {
+    return memory::heapBytes(element) +
+           memory::heapBytes(process) +
+           memory::heapBytes(boundary) +
+           memory::heapBytes(counts) +
+           memory::heapBytes(n_faces_on_boundary);
+  }
+
   // process-local element IDS (for all elements)
   std::vector<int> element;
 
@@ -0,0 +1,53 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+#include "MemoryFootprintInterface.h"
+
+/**
+ * Get the (estimated) memory held by one of the coupling data structures of the
+ * problem, such as the NekRS mesh mirror or the OpenMC element-to-cell mappings,
+ * reduced across ranks by taking the minimum, maximum, or sum.
+ */
+class CouplingMemory : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  CouplingMemory(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+
+  virtual Real getValue() override;
+
+protected:
+  /// Problem holding the coupling data structures
+  const MemoryFootprintInterface * _problem;
+
+  /// Name of the data structure, or 'total' for the sum over all data structures
+  const std::string _structure;
+
+  /// How to reduce the memory across ranks
+  const MooseEnum & _value_type;
+
+  /// Memory reduced across ranks
+  Real _value;
+};
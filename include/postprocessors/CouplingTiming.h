@@ -0,0 +1,61 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+/**
+ * Get the wall time spent in a timed section, such as one of the stages of
+ * the data transfers between MOOSE and NekRS or OpenMC. The time is either the
+ * cumulative time over the whole simulation, or the time spent since the previous
+ * execution of this postprocessor (i.e. the time per step), and is reduced
+ * across ranks by taking either the maximum or the average. The number of
+ * times the section has been entered can be reported instead of the time.
+ */
+class CouplingTiming : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  CouplingTiming(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+
+  virtual Real getValue() override;
+
+protected:
+  /// Full name of the timed section, including the prefix of the object which owns it
+  const std::string _section_name;
+
+  /// Whether to report the time since the previous execution, rather than the cumulative time
+  const bool _per_step;
+
+  /// Whether to report the number of times the section has been entered, rather than the time
+  const bool _calls;
+
+  /// Whether to average the time across ranks, rather than take the maximum
+  const bool _average;
+
+  /// Cumulative time on this rank at the previous execution
+  Real _previous_time;
+
+  /// Time reduced across ranks
+  Real _value;
+};
@@ -0,0 +1,51 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "NekPostprocessor.h"
+
+/**
+ * Get the number of calls, bytes received, or wall time spent in the collective
+ * communication that Cardinal issues on NekRS's communicator, accumulated since
+ * the start of the simulation.
+ */
+class NekCollectiveCounter : public NekPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  NekCollectiveCounter(const InputParameters & parameters);
+
+  virtual void execute() override;
+
+  virtual Real getValue() override;
+
+protected:
+  /// Collectives to count, or empty for all collectives
+  std::vector<nekrs::comm::CollectiveEnum> _collectives;
+
+  /// Quantity to report
+  const MooseEnum & _value_type;
+
+  /// Whether to average across ranks, rather than take the maximum
+  const bool _average;
+
+  /// Quantity reduced across ranks
+  Real _value;
+};
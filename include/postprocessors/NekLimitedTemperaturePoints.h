@@ -0,0 +1,42 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+#pragma once
+
+#include "NekPostprocessor.h"
+
+class NekRSProblem;
+
+/**
+ * Number of GLL points at which the NekRS temperature was clamped on the most recent
+ * time step by the 'min_T' and/or 'max_T' limiters on NekRSProblem. A nonzero value
+ * indicates that the limiter is actively modifying the solution, which is usually a
+ * sign of an underresolved flow.
+ */
+class NekLimitedTemperaturePoints : public NekPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  NekLimitedTemperaturePoints(const InputParameters & parameters);
+
+  virtual Real getValue() override;
+
+protected:
+  /// Problem applying the temperature limiter
+  const NekRSProblem * _nek_rs_problem;
+};
@@ -38,5 +38,9 @@ public:
   NekMassFluxWeightedSideAverage(const InputParameters & parameters);
 
   virtual Real getValue() override;
+
+protected:
+  /// Reduction computing the mass flowrate by which to normalize
+  std::vector<unsigned int> _mass_flowrate;
 };
 
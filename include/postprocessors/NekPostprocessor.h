@@ -45,6 +45,25 @@ public:
   virtual void checkValidField(const field::NekFieldEnum & field) const;
 
 protected:
+  /**
+   * Register a reduction with the engine shared by all Nek postprocessors. For
+   * 'field = velocity_component', each of the three velocity components is registered.
+   * @param[in] boundary boundary IDs over which to reduce, or empty for the whole volume
+   * @param[in] type type of reduction
+   * @param[in] field field to reduce
+   * @return indices of the registered reductions
+   */
+  std::vector<unsigned int> addReduction(const std::vector<int> & boundary,
+    const reduction::ReductionEnum & type, const field::NekFieldEnum & field) const;
+
+  /**
+   * Get the value of a reduction registered with addReduction
+   * @param[in] indices indices of the registered reductions
+   * @param[in] velocity_direction direction onto which to project velocity, for 'field = velocity_component'
+   * @return reduced value
+   */
+  Real reducedValue(const std::vector<unsigned int> & indices, const Point & velocity_direction = Point()) const;
+
   /// Base mesh this postprocessor acts on
   const MooseMesh & _mesh;
 
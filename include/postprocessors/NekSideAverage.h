@@ -38,6 +38,6 @@ public:
   virtual Real getValue() override;
 
 protected:
-  /// Area by which to normalize
-  Real _area;
+  /// Reduction computing the area by which to normalize
+  std::vector<unsigned int> _area;
 };
@@ -40,5 +40,8 @@ public:
 protected:
   /// type of extrema operation
   const operation::OperationEnum _type;
+
+  /// Reduction computing the extreme value
+  std::vector<unsigned int> _extreme_value;
 };
 
@@ -36,5 +36,16 @@ public:
   NekSideIntegral(const InputParameters & parameters);
 
   virtual Real getValue() override;
+
+protected:
+  /**
+   * Constructor for derived classes that integrate a differently-weighted field
+   * @param[in] parameters input parameters
+   * @param[in] type type of reduction to register
+   */
+  NekSideIntegral(const InputParameters & parameters, const reduction::ReductionEnum & type);
+
+  /// Reduction(s) computing the integral
+  std::vector<unsigned int> _integral;
 };
 
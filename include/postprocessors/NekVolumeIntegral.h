@@ -38,6 +38,9 @@ public:
   virtual Real getValue() override;
 
 protected:
-  /// Volume by which to normalize
-  Real _volume;
+  /// Reduction(s) computing the integral
+  std::vector<unsigned int> _integral;
+
+  /// Reduction computing the volume by which to normalize
+  std::vector<unsigned int> _volume;
 };
@@ -44,6 +44,9 @@ protected:
   /// Characteristic length
   const Real * _L_ref;
 
-  /// Area by which to compute the Reynolds number
-  Real _area;
+  /// Reduction computing the area by which to compute the Reynolds number
+  std::vector<unsigned int> _area;
+
+  /// Reduction computing the mass flowrate
+  std::vector<unsigned int> _mass_flowrate;
 };
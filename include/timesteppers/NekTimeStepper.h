@@ -76,6 +76,25 @@ protected:
 
   Real _nek_dt;
 
+  /// Target CFL number, if adapting the time step
+  const Real * _target_cfl = nullptr;
+
+  /// Maximum factor by which the time step may increase from one step to the next
+  const Real & _growth_factor;
+
+  /// Minimum factor by which the time step may decrease from one step to the next
+  const Real & _shrink_factor;
+
+  /// Maximum time step size, if adapting the time step
+  const Real * _max_dt = nullptr;
+
+  /**
+   * Most recent time step size selected by this time stepper, before being constrained
+   * by the executioner (such as to hit a synchronization time with the master application);
+   * this is restartable so that an adaptive time step continues from where it left off
+   */
+  Real & _proposed_dt;
+
   /// Reference time scale
   Real _t_ref;
 };
@@ -20,8 +20,11 @@
 
 #include "MultiAppTransfer.h"
 
+class BatchSpatialValueInterface;
+
 /**
- * Copies the value of a Postprocessor from the Master to a MultiApp.
+ * Copies the spatial values of a UserObject into a NearestPointReceiver, evaluating
+ * the values at the receiver positions.
  */
 class NearestPointReceiverTransfer : public MultiAppTransfer
 {
@@ -33,6 +36,48 @@ public:
   virtual void execute() override;
 
 protected:
+  /**
+   * Evaluate a user object at a set of points, in one batch if the user object supports it
+   * @param[in] app global index of the sub-app this evaluation is for
+   * @param[in] uo user object
+   * @param[in] points points at which to evaluate the user object
+   * @param[out] values values at the points
+   */
+  void spatialValues(const unsigned int app, const UserObject & uo,
+    const std::vector<Point> & points, std::vector<Real> & values);
+
+  /**
+   * Fill the master receiver with values from all of the sub-apps, each receiver position
+   * taking its value from the sub-app given in 'receiver_sub_apps', or else from the
+   * sub-app positioned nearest to it
+   */
+  void assembleFromMultiApp();
+
   UserObjectName _from_uo_name;
   UserObjectName _to_uo_name;
+
+  /// Whether to assemble the values from all of the sub-apps into the master receiver
+  const bool & _assemble_from_sub_apps;
+
+  /// Sub-app providing the value at each receiver position, when assembling from the sub-apps
+  const std::vector<unsigned int> * _receiver_sub_apps = nullptr;
+
+  /// Whether to cache the source index of each point between executions
+  const bool & _cache_source_indices;
+
+  /// Source indices resolved for the points of one sub-app's evaluation
+  struct SourceIndexCache
+  {
+    /// user object the indices were resolved with
+    const BatchSpatialValueInterface * source = nullptr;
+
+    /// points the indices were resolved for
+    std::vector<Point> points;
+
+    /// source index of each point
+    std::vector<unsigned int> indices;
+  };
+
+  /// Cached source indices, for each global sub-app
+  std::vector<SourceIndexCache> _source_index_cache;
 };
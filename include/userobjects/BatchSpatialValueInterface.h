@@ -0,0 +1,66 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/point.h"
+
+#include <vector>
+
+/**
+ * Interface for user objects whose spatial value is one of a discrete set of source
+ * values (such as a bin or a nearest point), which transfers use to evaluate many points
+ * at once. Because the source index of a point only depends on the geometry, transfers
+ * may also resolve the source indices once and then only look up the values.
+ * For any set of points, the result must be identical to calling spatialValue() for each.
+ */
+class BatchSpatialValueInterface
+{
+public:
+  virtual ~BatchSpatialValueInterface() = default;
+
+  /**
+   * Get the index of the source value providing the spatial value at each of a set of points
+   * @param[in] points points
+   * @param[out] indices source index of each point
+   */
+  virtual void sourceIndices(const std::vector<Point> & points, std::vector<unsigned int> & indices) const = 0;
+
+  /**
+   * Get a source value
+   * @param[in] index source index
+   * @return source value
+   */
+  virtual Real sourceValue(const unsigned int index) const = 0;
+
+  /**
+   * Get the spatial value at each of a set of points
+   * @param[in] points points at which to evaluate the spatial value
+   * @param[out] values spatial value at each point
+   */
+  void spatialValues(const std::vector<Point> & points, std::vector<Real> & values) const
+  {
+    std::vector<unsigned int> indices;
+    sourceIndices(points, indices);
+
+    values.resize(points.size());
+    for (unsigned int i = 0; i < points.size(); ++i)
+      values[i] = sourceValue(indices[i]);
+  }
+};
@@ -22,13 +22,17 @@
 #include "NearestPointBase.h"
 #include "ElementAverageValue.h"
 #include "ElementVariableVectorPostprocessor.h"
+#include "NearestPointLocator.h"
+#include "BatchSpatialValueInterface.h"
+
 /**
  * Given a list of points this object computes the variable integral
  * closest to each one of those points.
  */
 class CardinalNearestPointAverage
   : public NearestPointBase<ElementAverageValue,
-                            ElementVariableVectorPostprocessor>
+                            ElementVariableVectorPostprocessor>,
+    public BatchSpatialValueInterface
 {
 public:
   CardinalNearestPointAverage(const InputParameters & parameters);
@@ -37,6 +41,11 @@ public:
 
   virtual Real spatialValue(const Point & point) const override;
 
+  virtual void sourceIndices(const std::vector<Point> & points,
+                             std::vector<unsigned int> & indices) const override;
+
+  virtual Real sourceValue(const unsigned int index) const override { return userObjectValue(index); }
+
   Real userObjectValue(unsigned int i) const;
 
   unsigned int nearestPointIndex(const Point & point) const;
@@ -45,4 +54,7 @@ public:
 
 protected:
   VectorPostprocessorValue & _np_post_processor_values;
+
+  /// Spatial index over the points for finding the nearest point
+  std::unique_ptr<NearestPointLocator> _locator;
 };
@@ -34,6 +34,8 @@ public:
 
   virtual const unsigned int bin(const Point & p) const override;
 
+  virtual void bins(const std::vector<Point> & points, std::vector<unsigned int> & indices) const override;
+
   virtual const unsigned int num_bins() const override;
 
 protected:
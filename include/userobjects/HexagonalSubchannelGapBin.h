@@ -34,6 +34,8 @@ public:
 
   virtual const unsigned int bin(const Point & p) const override;
 
+  virtual void bins(const std::vector<Point> & points, std::vector<unsigned int> & indices) const override;
+
   virtual const unsigned int num_bins() const override;
 
   virtual Real distanceFromGap(const Point & point, const unsigned int & gap_index) const override;
@@ -42,6 +44,9 @@ public:
 
   virtual void gapIndexAndDistance(const Point & point, unsigned int & index, Real & distance) const override;
 
+  virtual void gapIndicesAndDistances(const std::vector<Point> & points,
+    std::vector<unsigned int> & indices, std::vector<Real> & distances) const override;
+
   virtual const std::vector<Point> & gapUnitNormals() const override { return _hex_lattice->gapUnitNormals(); }
 
 protected:
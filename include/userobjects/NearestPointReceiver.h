@@ -19,6 +19,8 @@
 #pragma once
 
 #include "GeneralUserObject.h"
+#include "BatchSpatialValueInterface.h"
+#include "NearestPointLocator.h"
 
 #include "libmesh/point.h"
 
@@ -26,7 +28,7 @@
  * Allows for setting values that are associated with points in space.
  * The spatialValue() function will then return the nearest value.
  */
-class NearestPointReceiver : public GeneralUserObject
+class NearestPointReceiver : public GeneralUserObject, public BatchSpatialValueInterface
 {
 public:
   NearestPointReceiver(const InputParameters & parameters);
@@ -40,6 +42,10 @@ public:
 
   virtual Real spatialValue(const Point & p) const override;
 
+  virtual void sourceIndices(const std::vector<Point> & points, std::vector<unsigned int> & indices) const override;
+
+  virtual Real sourceValue(const unsigned int index) const override { return _data[index]; }
+
   const std::vector<Point> & positions() { return _positions; }
 
   void setValues(const std::vector<Real> & values);
@@ -53,5 +59,8 @@ protected:
   const std::vector<Point> & _positions;
 
   std::vector<Real> _data;
+
+  /// Spatial index over the positions for finding the nearest position
+  const NearestPointLocator _locator;
 };
 
@@ -43,8 +43,35 @@ public:
    */
   virtual void binnedPlaneIntegral(const field::NekFieldEnum & integrand, double * total_integral);
 
+  /**
+   * Compute a plane integral of all three velocity components over the bins in a single
+   * pass over the mesh, with one reduction for all components
+   */
+  virtual void binnedVelocityPlaneIntegral();
+
   /**
    * Compute the integrals
    */
   virtual void computeIntegral();
+
+protected:
+  virtual unsigned int velocityDirectionIndex(const unsigned int & total_bin_index) const override;
+
+  /**
+   * Cache the bin of each point on the NekRS mesh; for moving meshes, this is
+   * repeated each time the integrals are computed
+   */
+  void mapPointsToBins();
+
+  /**
+   * Get the cached bin of a point on the NekRS mesh, if the point lies within the gap thickness
+   * @param[in] local_elem_id local element ID on the Nek rank
+   * @param[in] local_node_id local node ID on the element
+   * @param[out] b bin index
+   * @return whether the point contributes to the plane integral
+   */
+  bool planeBin(const int & local_elem_id, const int & local_node_id, unsigned int & b) const;
+
+  /// Whether each point on the NekRS mesh (or element, when mapping by centroid) lies within the gap thickness
+  std::vector<bool> _point_in_gap;
 };
@@ -43,8 +43,21 @@ public:
    */
   virtual void binnedSideIntegral(const field::NekFieldEnum & integrand, double * total_integral);
 
+  /**
+   * Compute a side integral of all three velocity components over the bins in a single
+   * pass over the mesh, with one reduction for all components
+   */
+  virtual void binnedVelocitySideIntegral();
+
   /**
    * Compute the integrals
    */
   virtual void computeIntegral();
+
+protected:
+  /**
+   * Cache the bin of each point on the NekRS mesh; for moving meshes, this is
+   * repeated each time the integrals are computed
+   */
+  void mapPointsToBins();
 };
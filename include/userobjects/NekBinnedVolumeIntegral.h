@@ -42,4 +42,17 @@ public:
    * @param[out] total_integral integrated values in each bin
    */
   virtual void binnedVolumeIntegral(const field::NekFieldEnum & integrand, double * total_integral);
+
+  /**
+   * Compute a volume integral of all three velocity components over the bins in a single
+   * pass over the mesh, with one reduction for all components
+   */
+  virtual void binnedVelocityVolumeIntegral();
+
+protected:
+  /**
+   * Cache the bin of each point on the NekRS mesh; for moving meshes, this is
+   * repeated each time the integrals are computed
+   */
+  void mapPointsToBins();
 };
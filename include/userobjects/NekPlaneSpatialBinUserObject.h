@@ -40,6 +40,9 @@ public:
 
   virtual void gapIndexAndDistance(const Point & point, unsigned int & index, Real & distance) const;
 
+  virtual void gapIndicesAndDistances(const std::vector<Point> & points,
+    std::vector<unsigned int> & indices, std::vector<Real> & distances) const;
+
 protected:
   /// Width of region enclosing gap for which points contribute to gap integral
   const Real & _gap_thickness;
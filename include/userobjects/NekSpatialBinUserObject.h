@@ -20,13 +20,14 @@
 
 #include "NekUserObject.h"
 #include "SpatialBinUserObject.h"
+#include "BatchSpatialValueInterface.h"
 
 /**
  * Class that performs various postprocessing operations on the
  * NekRS solution with a spatial binning formed as the product
  * of an arbitrary number of combined single-set bins.
  */
-class NekSpatialBinUserObject : public NekUserObject
+class NekSpatialBinUserObject : public NekUserObject, public BatchSpatialValueInterface
 {
 public:
   static InputParameters validParams();
@@ -37,6 +38,18 @@ public:
 
   virtual Real spatialValue(const Point & p) const override final;
 
+  /**
+   * Get the total combined bin index of each of a set of points, which indexes the bin values
+   * @param[in] points points
+   * @param[out] indices total combined bin index of each point
+   */
+  virtual void sourceIndices(const std::vector<Point> & points, std::vector<unsigned int> & indices) const override final
+  {
+    bins(points, indices);
+  }
+
+  virtual Real sourceValue(const unsigned int index) const override final { return _bin_values[index]; }
+
   /**
    * When using 'field = velocity_component', get the spatial value for a
    * particular component
@@ -47,6 +60,14 @@ public:
 
   virtual const unsigned int bin(const Point & p) const;
 
+  /**
+   * Get the total combined bin index for each of a set of points, classifying all of
+   * the points with each of the individual bin distributions at once
+   * @param[in] points points
+   * @param[out] indices total combined bin index of each point
+   */
+  void bins(const std::vector<Point> & points, std::vector<unsigned int> & indices) const;
+
   virtual const unsigned int num_bins() const;
 
   virtual const std::vector<Point> spatialPoints() const override { return _points; }
@@ -91,6 +112,67 @@ protected:
   /// Reset the scratch space storage to zero values
   void resetPartialStorage();
 
+  /**
+   * Number of points per element (or element face) that need to be mapped to bins;
+   * when mapping by centroid, every GLL point shares the bin of its element's centroid
+   * @param[in] n_nodes number of GLL points per element (or element face)
+   * @return number of points to map to bins
+   */
+  int pointsToMap(const int & n_nodes) const { return _map_space_by_qp ? n_nodes : 1; }
+
+  /**
+   * Index of a GLL point into the cached bins in _point_bins
+   * @param[in] local_id local element (or boundary face) index
+   * @param[in] local_node_id local node ID on the element (or face)
+   * @param[in] n_nodes number of GLL points per element (or element face)
+   * @return index into the cached bins
+   */
+  int pointBinIndex(const int & local_id, const int & local_node_id, const int & n_nodes) const
+  {
+    return _map_space_by_qp ? local_id * n_nodes + local_node_id : local_id;
+  }
+
+  /**
+   * Sum the per-rank partial velocity integrals into the x, y, and z bin values with
+   * a single reduction over all three components
+   */
+  void reducePartialVelocity();
+
+  /**
+   * Add the contribution of a point to the per-rank partial velocity integrals
+   * @param[in] b total combined bin index of the point
+   * @param[in] id index of the point in the NekRS solution arrays
+   * @param[in] weight quadrature weight of the point
+   */
+  void addPartialVelocity(const unsigned int & b, const int & id, const double & weight)
+  {
+    _bin_partial_velocity[b] += _velocity_x(id) * weight;
+    _bin_partial_velocity[_n_bins + b] += _velocity_y(id) * weight;
+    _bin_partial_velocity[2 * _n_bins + b] += _velocity_z(id) * weight;
+  }
+
+  /**
+   * Dimensionalize the x, y, and z bin values
+   * @param[in] dimensionalize function to dimensionalize an integral over a bin of given size
+   */
+  void dimensionalizeVelocity(void (*dimensionalize)(const field::NekFieldEnum &, const Real &, double &));
+
+  /**
+   * Project the x, y, and z bin values onto the velocity direction of each bin
+   * to get the bin values, for 'field = velocity_component'
+   */
+  void projectVelocity();
+
+  /**
+   * Index into the velocity directions for a bin
+   * @param[in] total_bin_index total combined bin index
+   * @return index into _velocity_bin_directions
+   */
+  virtual unsigned int velocityDirectionIndex(const unsigned int & total_bin_index) const
+  {
+    return total_bin_index;
+  }
+
   /**
    * Get the coordinates for a point at the given indices for the bins
    * @param[in] indices indices of the bin distributions to combine
@@ -145,6 +227,13 @@ protected:
   /// values of the userobject in each bin
   double * _bin_values;
 
+  /**
+   * Storage for the results of component-wise evaluations, for 'field = velocity_component'.
+   * The x, y, and z components are held contiguously so that they can be reduced together,
+   * with _bin_values_x, _bin_values_y, and _bin_values_z pointing into this buffer.
+   */
+  double * _bin_values_velocity;
+
   /// temporary storage space to hold the results of component-wise evaluations
   double * _bin_values_x;
   double * _bin_values_y;
@@ -159,9 +248,24 @@ protected:
    */
   int * _bin_counts;
 
+  /**
+   * Bin index of each point over which a derived class sums (or of each element, when
+   * mapping by centroid), cached at construction for fixed meshes and once per
+   * execution for moving meshes so that the sums only need to gather from this array
+   */
+  std::vector<unsigned int> _point_bins;
+
   /// Partial-sum of bin value per Nek rank
   double * _bin_partial_values;
 
   /// Partial-sum of bin count per Nek rank
   int * _bin_partial_counts;
+
+  /// Partial-sum of the x, y, and z bin values per Nek rank, for 'field = velocity_component'
+  double * _bin_partial_velocity;
+
+  /// Functions returning the x, y, and z velocity at a point, for 'field = velocity_component'
+  double (*_velocity_x) (int);
+  double (*_velocity_y) (int);
+  double (*_velocity_z) (int);
 };
@@ -52,6 +52,16 @@ public:
    */
   virtual void gapIndexAndDistance(const Point & point, unsigned int & index, Real & distance) const = 0;
 
+  /**
+   * Closest gap index and distance to that gap for a set of points; derived classes which
+   * can classify many points more efficiently than one at a time should override this
+   * @param[in] points points
+   * @param[out] indices index of the gap that each point is closest to
+   * @param[out] distances distance from each point to its closest gap
+   */
+  virtual void gapIndicesAndDistances(const std::vector<Point> & points,
+    std::vector<unsigned int> & indices, std::vector<Real> & distances) const;
+
   /**
    * Get the unit normals for each gap
    * @return gap unit normals
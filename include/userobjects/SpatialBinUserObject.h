@@ -43,6 +43,14 @@ public:
    */
   virtual const unsigned int bin(const Point & p) const = 0;
 
+  /**
+   * Get the bin indices for a set of points; derived classes which can classify many
+   * points more efficiently than one at a time should override this
+   * @param[in] points points
+   * @param[out] indices bin index of each point
+   */
+  virtual void bins(const std::vector<Point> & points, std::vector<unsigned int> & indices) const;
+
   /**
    * Get the total number of bins
    * @return total number of bins
@@ -55,7 +63,7 @@ public:
    * @param[in] bounds vector of bounding points
    * @return layer
    */
-  unsigned int binFromBounds(const Real & pt, const std::vector<Real> & bounds) const;
+  static unsigned int binFromBounds(const Real & pt, const std::vector<Real> & bounds);
 
   /**
    * Get the bin centers
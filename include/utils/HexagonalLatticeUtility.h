@@ -65,6 +65,16 @@ public:
    */
   void gapIndexAndDistance(const Point & point, unsigned int & index, Real & distance) const;
 
+  /**
+   * Get the gap index and distance to that gap for each of a set of points; this gives
+   * the same result as gapIndexAndDistance() for each point
+   * @param[in] points points
+   * @param[out] indices index of closest gap to each point
+   * @param[out] distances distance from each point to its closest gap
+   */
+  void gapIndicesAndDistances(const std::vector<Point> & points, std::vector<unsigned int> & indices,
+    std::vector<Real> & distances) const;
+
   /**
    * Get the unit vector translation to move a center point to a duct wall
    * @param[in] side duct side
@@ -141,6 +151,15 @@ public:
    */
   const bool pointInPolygon(const Point & point, const std::vector<Point> & corners) const;
 
+  /**
+   * Whether a point is in a channel, using the corner coordinates stored for the channel;
+   * this gives the same result as pointInPolygon() with the channel's corner coordinates
+   * @param[in] point point of interest
+   * @param[in] channel channel index
+   * @return whether point is inside the channel
+   */
+  const bool pointInChannel(const Point & point, const unsigned int & channel) const;
+
   /**
    * Get the number of pins in a given ring
    * @param[in] n ring number, beginning from 1
@@ -544,6 +563,20 @@ public:
    */
   const std::vector<std::vector<int>> & localToGlobalGaps() const { return _local_to_global_gaps; }
 
+  /**
+   * Get the corner coordinates of a channel given an ID (relative to the start of
+   * the interior channels, i.e. in the same indexing as channelIndex())
+   * @param[in] channel ID of channel
+   * @return corner coordinates of channel
+   */
+  const std::vector<Point> channelCornerCoordinates(const unsigned int & channel) const;
+
+  /**
+   * Get the centroids of all the channels, in the same indexing as channelIndex()
+   * @return channel centroids
+   */
+  const std::vector<Point> & channelCentroids() const { return _channel_centroids; }
+
   /**
    * Get the corner coordinates of an interior channel given an ID
    * (relative to the start of the interior channels)
@@ -582,19 +615,54 @@ public:
   const Point channelCentroid(const std::vector<Point> & corners) const;
 
   /**
-   * Get the pin index given a point
+   * Get the pin index given a point, in constant time from the point's axial coordinates
+   * in the triangular lattice; points on the boundary between pins are assigned to the
+   * lowest-indexed pin containing them
    * @param[in] point point
-   * @return pin index
+   * @return pin index, or the number of pins if the point is not in any pin's hexagon
    */
   const unsigned int pinIndex(const Point & point) const;
 
   /**
-   * Get the channel index given a point
+   * Get the channel index given a point, in constant time from the point's axial coordinates
+   * in the triangular lattice (interior channels) or its sector of the bundle (edge channels);
+   * points on the boundary between channels are assigned to the lowest-indexed channel
+   * containing them
    * @param[in] point point
    * @return channel index
    */
   const unsigned int channelIndex(const Point & point) const;
 
+  /**
+   * Get the pin index given a point by checking every pin; this gives the same result as
+   * pinIndex(), but scales with the number of pins
+   * @param[in] point point
+   * @return pin index, or the number of pins if the point is not in any pin's hexagon
+   */
+  const unsigned int pinIndexLinearSearch(const Point & point) const;
+
+  /**
+   * Get the channel index given a point by checking every channel of the point's type;
+   * this gives the same result as channelIndex(), but scales with the number of channels
+   * @param[in] point point
+   * @return channel index
+   */
+  const unsigned int channelIndexLinearSearch(const Point & point) const;
+
+  /**
+   * Get the pin index for each of a set of points
+   * @param[in] points points
+   * @param[out] indices pin index of each point
+   */
+  void pinIndices(const std::vector<Point> & points, std::vector<unsigned int> & indices) const;
+
+  /**
+   * Get the channel index for each of a set of points
+   * @param[in] points points
+   * @param[out] indices channel index of each point
+   */
+  void channelIndices(const std::vector<Point> & points, std::vector<unsigned int> & indices) const;
+
   std::pair<int, int> sortedGap(const int & id0, const int & id1) const;
 
 protected:
@@ -794,6 +862,56 @@ protected:
   /// Center points of all the gaps
   std::vector<Point> _gap_centers;
 
+  /**
+   * x-coordinates of the corners of all the channels, stored contiguously in the same
+   * order as the channel indices; the corners of channel i are at the indices between
+   * _channel_corner_offsets[i] and _channel_corner_offsets[i + 1]
+   */
+  std::vector<Real> _channel_corner_x;
+
+  /// y-coordinates of the corners of all the channels
+  std::vector<Real> _channel_corner_y;
+
+  /// Offsets into the channel corner coordinates for each channel
+  std::vector<unsigned int> _channel_corner_offsets;
+
+  /// Centroids of all the channels
+  std::vector<Point> _channel_centroids;
+
+  /**
+   * Global gap indices of the gaps touching each channel, stored contiguously in the same
+   * order as the channel indices; the gaps of channel i are at the indices between
+   * _channel_gap_offsets[i] and _channel_gap_offsets[i + 1]
+   */
+  std::vector<unsigned int> _channel_gaps;
+
+  /// Offsets into the channel gap data for each channel
+  std::vector<unsigned int> _channel_gap_offsets;
+
+  /// Coefficient \f$a\f$ in \f$ax+by+c=0\f$ for the line through each channel gap
+  std::vector<Real> _channel_gap_a;
+
+  /// Coefficient \f$b\f$ in \f$ax+by+c=0\f$ for the line through each channel gap
+  std::vector<Real> _channel_gap_b;
+
+  /// Coefficient \f$c\f$ in \f$ax+by+c=0\f$ for the line through each channel gap
+  std::vector<Real> _channel_gap_c;
+
+  /// Norm \f$\sqrt{a^2+b^2}\f$ of the line through each channel gap
+  std::vector<Real> _channel_gap_norm;
+
+  /// Number of axial lattice coordinates spanned by the lookup tables in each direction
+  int _lookup_width;
+
+  /// Pin index at each (q, r) axial lattice coordinate, or -1 if there is no pin there
+  std::vector<int> _pin_lookup;
+
+  /**
+   * Interior channel index of the two triangles in the lattice rhombus whose lowest
+   * corner is at each (q, r) axial lattice coordinate, or -1 if there is no channel there
+   */
+  std::vector<int> _interior_channel_lookup;
+
 private:
   /// Determine the global gap indices, sorted first by lower pin ID and next by higher pin ID
   void computeGapIndices();
@@ -826,4 +944,63 @@ private:
 
   /// Get the pin indices that form the corners of each channel type
   void computeChannelPinIndices();
+
+  /// Compute the corner coordinates and centroids of all the channels
+  void computeChannelCorners();
+
+  /// Gather the line coefficients of the gaps touching each channel into contiguous storage
+  void computeChannelGapCoefficients();
+
+  /// Build the tables used to look up the pin and interior channel for an axial lattice coordinate
+  void computeLookupTables();
+
+  /**
+   * Get the closest gap to a point among the gaps touching a channel
+   * @param[in] point point
+   * @param[in] channel channel index
+   * @param[out] index index of closest gap
+   * @param[out] distance distance to closest gap
+   */
+  void closestChannelGap(const Point & point, const unsigned int & channel, unsigned int & index,
+    Real & distance) const;
+
+  /**
+   * Get the (fractional) axial lattice coordinates of a point, relative to the basis
+   * vectors \f$(p, 0)\f$ and \f$(p/2, p\sqrt{3}/2)\f$, where \f$p\f$ is the pin pitch
+   * @param[in] point point
+   * @param[out] q coordinate along the first basis vector
+   * @param[out] r coordinate along the second basis vector
+   */
+  void axialCoordinates(const Point & point, Real & q, Real & r) const;
+
+  /**
+   * Get the pin at an axial lattice coordinate
+   * @param[in] q coordinate along the first basis vector
+   * @param[in] r coordinate along the second basis vector
+   * @return pin index, or -1 if there is no pin there
+   */
+  int pinAt(const int q, const int r) const;
+
+  /**
+   * Get the interior channel formed by one of the triangles of a lattice rhombus
+   * @param[in] q coordinate of the rhombus's lowest corner along the first basis vector
+   * @param[in] r coordinate of the rhombus's lowest corner along the second basis vector
+   * @param[in] upper whether to get the upper (rather than lower) triangle in the rhombus
+   * @return interior channel index, or -1 if there is no channel there
+   */
+  int interiorChannelAt(const int q, const int r, const bool upper) const;
+
+  /**
+   * Get the interior channel index given a point
+   * @param[in] point point
+   * @return interior channel index, or -1 if the point is not in any interior channel
+   */
+  int interiorChannelIndex(const Point & point) const;
+
+  /**
+   * Get the edge channel index given a point
+   * @param[in] point point
+   * @return edge channel index, or -1 if the point is not in any edge channel
+   */
+  int edgeChannelIndex(const Point & point) const;
 };
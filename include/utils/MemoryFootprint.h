@@ -0,0 +1,119 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Estimates of the heap memory held by standard containers, used to report the memory
+ * footprint of the coupling data structures. Containers are assumed to allocate one node
+ * per entry (for maps) or one contiguous block (for vectors); allocator bookkeeping is
+ * not included, so these are lower bounds on the memory actually in use.
+ */
+namespace memory
+{
+template <typename T>
+std::size_t heapBytes(const T & value);
+
+template <typename T>
+std::size_t heapBytes(const std::vector<T> & vector);
+
+template <typename K, typename V>
+std::size_t heapBytes(const std::pair<K, V> & pair);
+
+template <typename K, typename V>
+std::size_t heapBytes(const std::map<K, V> & map);
+
+template <typename K, typename V>
+std::size_t heapBytes(const std::unordered_map<K, V> & map);
+
+/**
+ * Heap memory held by a value without any dynamically-allocated members
+ * @param[in] value value
+ * @return zero
+ */
+template <typename T>
+std::size_t heapBytes(const T & /* value */)
+{
+  return 0;
+}
+
+/**
+ * Heap memory held by a vector, including that held by its entries
+ * @param[in] vector vector
+ * @return bytes
+ */
+template <typename T>
+std::size_t heapBytes(const std::vector<T> & vector)
+{
+  std::size_t bytes = vector.capacity() * sizeof(T);
+  for (const auto & v : vector)
+    bytes += heapBytes(v);
+
+  return bytes;
+}
+
+/**
+ * Heap memory held by the members of a pair
+ * @param[in] pair pair
+ * @return bytes
+ */
+template <typename K, typename V>
+std::size_t heapBytes(const std::pair<K, V> & pair)
+{
+  return heapBytes(pair.first) + heapBytes(pair.second);
+}
+
+/**
+ * Heap memory held by an ordered map, whose nodes each hold an entry, three
+ * pointers, and a color
+ * @param[in] map map
+ * @return bytes
+ */
+template <typename K, typename V>
+std::size_t heapBytes(const std::map<K, V> & map)
+{
+  std::size_t bytes = map.size() * (sizeof(std::pair<const K, V>) + 4 * sizeof(void *));
+  for (const auto & m : map)
+    bytes += heapBytes(m.first) + heapBytes(m.second);
+
+  return bytes;
+}
+
+/**
+ * Heap memory held by an unordered map, whose nodes each hold an entry, a pointer,
+ * and a cached hash, plus one pointer per bucket
+ * @param[in] map map
+ * @return bytes
+ */
+template <typename K, typename V>
+std::size_t heapBytes(const std::unordered_map<K, V> & map)
+{
+  std::size_t bytes = map.bucket_count() * sizeof(void *) +
+                      map.size() * (sizeof(std::pair<const K, V>) + 2 * sizeof(void *));
+  for (const auto & m : map)
+    bytes += heapBytes(m.first) + heapBytes(m.second);
+
+  return bytes;
+}
+} // namespace memory
@@ -0,0 +1,109 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "Moose.h"
+#include "MooseTypes.h"
+#include "libmesh/point.h"
+
+#include <vector>
+
+/**
+ * \brief Finds the nearest of a fixed set of points to a query point
+ *
+ * The points are sorted into a uniform grid of cells spanning their bounding box, with
+ * (on average) about one point per cell and at most twice as many cells as points. A query searches outwards from the cell containing
+ * the query point in shells of cells, stopping once no unsearched cell can hold a closer
+ * point. When several points are equally close, the lowest index is returned, so that the
+ * result is identical to a linear scan over the points.
+ */
+class NearestPointLocator
+{
+public:
+  /**
+   * @param[in] points points to search; a copy is held
+   */
+  NearestPointLocator(const std::vector<Point> & points);
+
+  /**
+   * Get the index of the point nearest to a query point
+   * @param[in] p query point
+   * @return index of nearest point
+   */
+  unsigned int nearest(const Point & p) const;
+
+  /**
+   * Get the index of the point nearest to a query point by checking every point;
+   * this gives the same result as nearest(), but scales with the number of points
+   * @param[in] p query point
+   * @return index of nearest point
+   */
+  unsigned int nearestLinearSearch(const Point & p) const;
+
+  /**
+   * Get the number of points
+   * @return number of points
+   */
+  unsigned int size() const { return _points.size(); }
+
+  /**
+   * Get the number of cells in the grid
+   * @return number of cells
+   */
+  unsigned int nCells() const { return _n[0] * _n[1] * _n[2]; }
+
+protected:
+  /**
+   * Get the cell index along one direction for a coordinate, clamped to the grid
+   * @param[in] x coordinate
+   * @param[in] d direction
+   * @return cell index
+   */
+  int cell(const Real & x, const unsigned int d) const;
+
+  /**
+   * Check all the points in a cell, keeping the closest (lowest index on ties)
+   * @param[in] p query point
+   * @param[in] i cell index in the x direction
+   * @param[in] j cell index in the y direction
+   * @param[in] k cell index in the z direction
+   * @param[in,out] closest index of closest point
+   * @param[in,out] closest_distance distance to closest point
+   */
+  void checkCell(const Point & p, const int i, const int j, const int k,
+    unsigned int & closest, Real & closest_distance) const;
+
+  /// Points to search
+  const std::vector<Point> _points;
+
+  /// Lower corner of the grid
+  Point _min;
+
+  /// Cell width in each direction
+  Point _width;
+
+  /// Number of cells in each direction
+  int _n[3];
+
+  /// Offsets into _cell_points for each cell, in x-major order
+  std::vector<unsigned int> _cell_offsets;
+
+  /// Point indices sorted by cell, in increasing order within each cell
+  std::vector<unsigned int> _cell_points;
+};
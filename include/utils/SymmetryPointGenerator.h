@@ -21,6 +21,7 @@
 #include "Moose.h"
 #include "MooseTypes.h"
 #include "libmesh/point.h"
+#include "libmesh/tensor_value.h"
 
 /**
  * Class that rotates/reflects a point about symmetry planes; the origin
@@ -63,6 +64,14 @@ public:
    */
   Point rotatePointAboutAxis(const Point & p, const Real & angle, const Point & axis) const;
 
+  /**
+   * Get the matrix which rotates a point about an axis
+   * @param[in] angle angle to rotate (radians)
+   * @param[in] axis axis expressed as vector
+   * @return rotation matrix
+   */
+  RealTensorValue rotationMatrix(const Real & angle, const Point & axis) const;
+
   /**
    * Transform point coordinates according to class settings
    * @param[in] p point
@@ -71,12 +80,29 @@ public:
   Point transformPoint(const Point & p) const;
 
   /**
-   * Sector of point
+   * Transform the coordinates of many points according to class settings
+   * @param[in] points points
+   * @param[out] transformed transformed points
+   */
+  void transformPoints(const std::vector<Point> & points, std::vector<Point> & transformed) const;
+
+  /**
+   * Sector of point about the rotational axis, found by comparing against the precomputed
+   * sector edges
    * @param[in] p point
    * @return sector
    */
   int sector(const Point & p) const;
 
+  /**
+   * Sector of point, found from the angle of the point relative to the zero-theta line;
+   * for points perpendicular to the rotational axis, this gives the same result as sector(),
+   * but requires inverse trigonometric functions
+   * @param[in] p point
+   * @return sector
+   */
+  int sectorFromAngle(const Point & p) const;
+
 protected:
   /// Normal defining the first symmetry plane
   Point _normal;
@@ -95,4 +121,13 @@ protected:
 
   /// Whether rotational symmetry is applied
   bool _rotational_symmetry;
+
+  /// Number of angular sectors
+  unsigned int _n_sectors;
+
+  /// Unit vectors along the lower edge of each sector, in the plane of the zero-theta line and negative normal
+  std::vector<std::pair<Real, Real>> _sector_edges;
+
+  /// Rotation matrix mapping each sector back onto the first sector
+  std::vector<RealTensorValue> _sector_rotations;
 };
@@ -0,0 +1,213 @@
+#********************************************************************/
+#*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+#*                             Cardinal                             */
+#*                                                                  */
+#*                  (c) 2021 UChicago Argonne, LLC                  */
+#*                        ALL RIGHTS RESERVED                       */
+#*                                                                  */
+#*                 Prepared by UChicago Argonne, LLC                */
+#*               Under Contract No. DE-AC02-06CH11357               */
+#*                With the U. S. Department of Energy               */
+#*                                                                  */
+#*             Prepared by Battelle Energy Alliance, LLC            */
+#*               Under Contract No. DE-AC07-05ID14517               */
+#*                With the U. S. Department of Energy               */
+#*                                                                  */
+#*                 See LICENSE for full restrictions                */
+#********************************************************************/
+
+# This script runs the scaling benchmarks in test/scaling over a range of problem
+# sizes and MPI rank counts, and collects the wall time and the per-phase timings
+# reported by each run. This script is run with:
+#
+# python scaling_study.py [-case openmc nek] [-np 1 2 4] [-rings 2 4 8] [-layers 10]
+#                         [-elems 4 8 16] [-particles 1000] [-n-threads 1]
+#                         [-mpiexec mpiexec] [-o scaling_study]
+#
+# - 'openmc' runs a hexagonal lattice of pins (test/scaling/openmc_lattice) with
+#   each number of rings in -rings, and -layers axial layers
+# - 'nek' runs a cube of NekRS elements (test/scaling/nek_box), coupled to a MOOSE
+#   master application, with each number of elements per side in -elems
+# - every case is run with each number of MPI ranks in -np
+#
+# The timings are taken from every postprocessor in the final row of the CSV output
+# of each run and its sub-applications (the inputs use CouplingTiming postprocessors
+# for each stage of the coupling). All results are written to <o>.json and, one row per run, to <o>.csv.
+
+from argparse import ArgumentParser
+import csv
+import glob
+import json
+import os
+import struct
+import subprocess
+import sys
+import time
+
+program_description = ("Script for measuring how the OpenMC and NekRS wrappings scale "
+                       "with problem size and number of MPI ranks")
+ap = ArgumentParser(description=program_description)
+
+ap.add_argument('-case', dest='cases', type=str, nargs='+', default=['openmc', 'nek'],
+                choices=['openmc', 'nek'], help='Benchmark cases to run')
+ap.add_argument('-np', dest='ranks', type=int, nargs='+', default=[1, 2, 4],
+                help='Numbers of MPI ranks to run each case with')
+ap.add_argument('-rings', dest='rings', type=int, nargs='+', default=[2, 4, 8],
+                help='Numbers of rings of pins in the OpenMC lattice')
+ap.add_argument('-layers', dest='layers', type=int, default=10,
+                help='Number of axial layers in the OpenMC lattice')
+ap.add_argument('-particles', dest='particles', type=int, default=1000,
+                help='Number of OpenMC particles per batch')
+ap.add_argument('-elems', dest='elems', type=int, nargs='+', default=[4, 8, 16],
+                help='Numbers of NekRS elements along each side of the cube')
+ap.add_argument('-n-threads', dest='n_threads', type=int, default=1,
+                help='Number of threads to run Cardinal with')
+ap.add_argument('-mpiexec', dest='mpiexec', type=str, default='mpiexec',
+                help='MPI launcher')
+ap.add_argument('-o', dest='output', type=str, default='scaling_study',
+                help='Base name of the files to write the results to')
+
+args = ap.parse_args()
+
+file_path = os.path.realpath(__file__)
+file_dir, file_name = os.path.split(file_path)
+exec_dir, file_name = os.path.split(file_dir)
+scaling_dir = os.path.join(exec_dir, 'test', 'scaling')
+
+# methods to look for, in order of preference
+methods = ['opt', 'devel', 'oprof', 'dbg']
+exec_name = ''
+for i in methods:
+  if (os.path.exists(exec_dir + "/cardinal-" + i)):
+    exec_name = exec_dir + "/cardinal-" + i
+    break
+
+if (exec_name == ''):
+  raise ValueError("No Cardinal executable was found!")
+
+def hex_pattern(n_rings):
+  """
+  Returns the PatternedHexMeshGenerator pattern for a hexagonal lattice with
+  n_rings rings of a single pin type
+  """
+  rows = [n_rings + i for i in range(n_rings)] + [2 * n_rings - 2 - i for i in range(n_rings - 1)]
+  return ';'.join(' '.join(['0'] * n) for n in rows)
+
+def write_box_re2(filename, n, length=1.0):
+  """
+  Writes a NekRS mesh of a cube of side 'length' with n hexahedral elements along
+  each side. Sideset 1 is the z = 0 face, and sideset 2 is the rest of the boundary.
+  """
+  n_elems = n**3
+  h = length / n
+
+  # whether a face (in the Nek ordering: -y, +x, +y, -x, -z, +z) is on the boundary
+  def on_boundary(i, j, k, face):
+    return [j == 0, i == n - 1, j == n - 1, i == 0, k == 0, k == n - 1][face - 1]
+
+  with open(filename, 'wb') as f:
+    header = '#v003{:9d}{:3d}{:9d} this is the hdr'.format(n_elems, 3, n_elems)
+    f.write(header.ljust(80).encode())
+    f.write(struct.pack('f', 6.54321))
+
+    for k in range(n):
+      for j in range(n):
+        for i in range(n):
+          x0, y0, z0 = i * h, j * h, k * h
+          x = [x0, x0 + h, x0 + h, x0] * 2
+          y = [y0, y0, y0 + h, y0 + h] * 2
+          z = [z0] * 4 + [z0 + h] * 4
+          f.write(struct.pack('25d', 0.0, *x, *y, *z))
+
+    # no curved sides
+    f.write(struct.pack('d', 0.0))
+
+    bcs = []
+    for k in range(n):
+      for j in range(n):
+        for i in range(n):
+          e = i + n * (j + n * k) + 1
+          for face in range(1, 7):
+            if on_boundary(i, j, k, face):
+              bcs.append((e, face, 1 if face == 5 else 2))
+
+    f.write(struct.pack('d', float(len(bcs))))
+    for e, face, sideset in bcs:
+      f.write(struct.pack('7d', e, face, 0.0, 0.0, 0.0, 1.0, sideset))
+      f.write('EXO'.ljust(8).encode())
+
+def run(case_dir, input_file, ranks, cli_args, file_base):
+  """
+  Runs Cardinal and returns the wall time, the exit code, and the postprocessor
+  values on the last row of the CSV output of the run and its sub-applications
+  """
+  cmd = [args.mpiexec, '-np', str(ranks), exec_name, '-i', input_file,
+         'Outputs/file_base=' + file_base, '--n-threads=' + str(args.n_threads)] + cli_args
+
+  start = time.time()
+  with open(os.path.join(case_dir, file_base + '.log'), 'w') as log:
+    status = subprocess.call(cmd, cwd=case_dir, stdout=log, stderr=subprocess.STDOUT)
+  wall_time = time.time() - start
+
+  # the postprocessors of sub-applications are prefixed by the sub-application name
+  postprocessors = {}
+  if (status == 0):
+    for csv_file in sorted(glob.glob(os.path.join(case_dir, file_base + '*.csv'))):
+      prefix = os.path.basename(csv_file)[len(file_base):-len('.csv')].lstrip('_')
+      with open(csv_file) as f:
+        rows = list(csv.DictReader(f))
+        if (len(rows) > 0):
+          for key, value in rows[-1].items():
+            postprocessors[prefix + '/' + key if prefix else key] = float(value)
+
+  return wall_time, status, postprocessors
+
+results = []
+
+if ('openmc' in args.cases):
+  case_dir = os.path.join(scaling_dir, 'openmc_lattice')
+  for n_rings in args.rings:
+    subprocess.check_call([sys.executable, 'make_openmc_model.py', '-r', str(n_rings),
+                           '-n', str(args.layers), '-p', str(args.particles)], cwd=case_dir)
+
+    n_pins = 3 * n_rings * (n_rings - 1) + 1
+    for ranks in args.ranks:
+      file_base = 'openmc_{}_rings_{}_ranks'.format(n_rings, ranks)
+      cli_args = ['n_rings=' + str(n_rings), 'n_layers=' + str(args.layers),
+                  'Mesh/bundle/pattern=' + hex_pattern(n_rings)]
+
+      print('Running OpenMC lattice with {} pins on {} ranks'.format(n_pins, ranks))
+      wall_time, status, postprocessors = run(case_dir, 'openmc.i', ranks, cli_args, file_base)
+      results.append({'case': 'openmc', 'size': n_pins * args.layers * 3, 'ranks': ranks,
+                      'wall_time': wall_time, 'status': status, 'postprocessors': postprocessors})
+
+if ('nek' in args.cases):
+  case_dir = os.path.join(scaling_dir, 'nek_box')
+  for n in args.elems:
+    write_box_re2(os.path.join(case_dir, 'box.re2'), n)
+
+    for ranks in args.ranks:
+      file_base = 'nek_{}_elems_{}_ranks'.format(n, ranks)
+      cli_args = ['n_elems=' + str(n)]
+
+      print('Running NekRS box with {} elements on {} ranks'.format(n**3, ranks))
+      wall_time, status, postprocessors = run(case_dir, 'nek_master.i', ranks, cli_args, file_base)
+      results.append({'case': 'nek', 'size': n**3, 'ranks': ranks,
+                      'wall_time': wall_time, 'status': status, 'postprocessors': postprocessors})
+
+with open(args.output + '.json', 'w') as f:
+  json.dump(results, f, indent=2)
+
+names = sorted(set(name for r in results for name in r['postprocessors']
+                   if name.split('/')[-1] != 'time'))
+with open(args.output + '.csv', 'w') as f:
+  writer = csv.writer(f)
+  writer.writerow(['case', 'size', 'ranks', 'wall_time', 'status'] + names)
+  for r in results:
+    writer.writerow([r['case'], r['size'], r['ranks'], r['wall_time'], r['status']] +
+                    [r['postprocessors'].get(name, '') for name in names])
+
+for r in results:
+  if (r['status'] != 0):
+    print('Case {} of size {} on {} ranks failed; see the log in test/scaling'.format(
+          r['case'], r['size'], r['ranks']))
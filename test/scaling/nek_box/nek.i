@@ -0,0 +1,68 @@
+[Problem]
+  type = NekRSProblem
+  casename = 'box'
+[]
+
+[Mesh]
+  type = NekRSMesh
+  order = SECOND
+  volume = true
+[]
+
+[Executioner]
+  type = Transient
+
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
+
+[Postprocessors]
+  [max_T]
+    type = NekVolumeExtremeValue
+    field = temperature
+    value_type = max
+  []
+  [build_mesh_mirror]
+    type = CouplingTiming
+    section = 'NekRSMesh::buildMesh'
+    value_type = cumulative
+  []
+  [send_heat_source]
+    type = CouplingTiming
+    section = sendVolumeHeatSourceToNek
+    value_type = cumulative
+  []
+  [solve_nekrs]
+    type = CouplingTiming
+    section = solveNekRS
+    value_type = cumulative
+  []
+  [volume_solution]
+    type = CouplingTiming
+    section = volumeSolution
+    value_type = cumulative
+  []
+  [fill_aux_variable]
+    type = CouplingTiming
+    section = fillAuxVariable
+    value_type = cumulative
+  []
+  [collective_time]
+    type = NekCollectiveCounter
+    value_type = time
+  []
+  [collective_bytes]
+    type = NekCollectiveCounter
+    value_type = bytes
+  []
+  [max_memory]
+    type = CouplingMemory
+    structure = total
+  []
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'final'
+[]
@@ -0,0 +1,99 @@
+# Cube of NekRS elements for measuring how the NekRS wrapping scales with the number
+# of elements. The NekRS mesh (box.re2) has n_elems elements in each direction and is
+# written by scripts/scaling_study.py; the MOOSE mesh has the same resolution so that
+# the transfers exchange data over comparable meshes.
+
+n_elems = 4
+
+[Mesh]
+  [cube]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = ${n_elems}
+    ny = ${n_elems}
+    nz = ${n_elems}
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[AuxVariables]
+  [source]
+  []
+  [nek_temp]
+    initial_condition = 500.0
+  []
+[]
+
+[Functions]
+  [source]
+    type = ParsedFunction
+    value = '1000*(1+x)*(1+y)*(1+z)'
+  []
+[]
+
+[AuxKernels]
+  [source]
+    type = FunctionAux
+    variable = source
+    function = source
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.01
+[]
+
+[MultiApps]
+  [nek]
+    type = TransientMultiApp
+    app_type = CardinalApp
+    input_files = 'nek.i'
+    execute_on = timestep_end
+  []
+[]
+
+[Transfers]
+  [temperature]
+    type = MultiAppNearestNodeTransfer
+    source_variable = temp
+    direction = from_multiapp
+    multi_app = nek
+    variable = nek_temp
+  []
+  [source]
+    type = MultiAppNearestNodeTransfer
+    source_variable = source
+    direction = to_multiapp
+    multi_app = nek
+    variable = heat_source
+  []
+  [source_integral]
+    type = MultiAppPostprocessorTransfer
+    to_postprocessor = source_integral
+    direction = to_multiapp
+    from_postprocessor = source_integral
+    multi_app = nek
+  []
+[]
+
+[Postprocessors]
+  [source_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = source
+  []
+  [total_time]
+    type = PerfGraphData
+    section_name = 'Root'
+    data_type = TOTAL
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
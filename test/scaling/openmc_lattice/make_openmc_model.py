@@ -0,0 +1,120 @@
+#********************************************************************/
+#*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+#*                             Cardinal                             */
+#*                                                                  */
+#*                  (c) 2021 UChicago Argonne, LLC                  */
+#*                        ALL RIGHTS RESERVED                       */
+#*                                                                  */
+#*                 Prepared by UChicago Argonne, LLC                */
+#*               Under Contract No. DE-AC02-06CH11357               */
+#*                With the U. S. Department of Energy               */
+#*                                                                  */
+#*             Prepared by Battelle Energy Alliance, LLC            */
+#*               Under Contract No. DE-AC07-05ID14517               */
+#*                With the U. S. Department of Energy               */
+#*                                                                  */
+#*                 See LICENSE for full restrictions                */
+#********************************************************************/
+
+# Hexagonal lattice of UO2 pins in water, used to measure how the OpenMC wrapping
+# scales with the number of cells. The lattice has <n_rings> rings of pins (i.e.
+# 3 * n_rings * (n_rings - 1) + 1 pins) and <n_layers> axial layers, so that the
+# number of cells is 3 * (number of pins) * n_layers. This geometry must match the
+# mesh built in openmc.i, so please run this through scripts/scaling_study.py.
+
+from argparse import ArgumentParser
+import math
+import openmc
+
+R = 0.97 / 2.0           # outer radius of the pincell (cm)
+Rf = 0.825 / 2.0         # outer radius of the pellet (cm)
+pitch = 1.28             # pitch between pincells (cm)
+height = 10.0            # height of the lattice (cm)
+T_inlet = 573.0          # inlet water temperature (K)
+
+def lattice(n_rings, n_layers, particles):
+  H = height / n_layers
+
+  uo2 = openmc.Material(name='UO2')
+  uo2.set_density('g/cm3', 10.29769)
+  uo2.add_nuclide('U235', 0.05)
+  uo2.add_nuclide('U238', 0.95)
+  uo2.add_element('O', 2.0)
+
+  zircaloy = openmc.Material(name='Zircaloy')
+  zircaloy.set_density('g/cm3', 6.55)
+  zircaloy.add_element('Zr', 1.0)
+
+  water = openmc.Material(name='water')
+  water.set_density('g/cm3', 0.75)
+  water.add_element('H', 2.0)
+  water.add_element('O', 1.0)
+  water.add_s_alpha_beta('c_H_in_H2O')
+
+  model = openmc.model.Model()
+  model.materials = openmc.Materials([uo2, zircaloy, water])
+
+  pincell_surface = openmc.ZCylinder(r=R, name='Pincell outer radius')
+  pellet_surface = openmc.ZCylinder(r=Rf, name='Pellet outer radius')
+  fuel_cell = openmc.Cell(fill=uo2, region=-pellet_surface, name='Fuel')
+  clad_cell = openmc.Cell(fill=zircaloy, region=+pellet_surface & -pincell_surface, name='Clad')
+  water_cell = openmc.Cell(fill=water, region=+pincell_surface, name='Water')
+  pin_univ = openmc.Universe(cells=[fuel_cell, clad_cell, water_cell])
+
+  outer_cell = openmc.Cell(fill=water, name='Outside')
+  outer_univ = openmc.Universe(cells=[outer_cell])
+
+  # the same pin universe fills every position; each axial layer is a separate
+  # lattice element, so every pin in every layer is a distinct cell instance
+  rings = [[pin_univ] * max(6 * i, 1) for i in range(n_rings - 1, -1, -1)]
+
+  hex_lattice = openmc.HexLattice(name='Pin lattice')
+  hex_lattice.orientation = 'x'
+  hex_lattice.center = (0.0, 0.0, height / 2.0)
+  hex_lattice.pitch = (pitch, H)
+  hex_lattice.universes = [rings] * n_layers
+  hex_lattice.outer = outer_univ
+
+  # the bundle half flat-to-flat distance, which must match hexagon_size in openmc.i
+  bundle_apothem = n_rings * pitch
+
+  hex_prism = openmc.hexagonal_prism(2.0 * bundle_apothem / math.sqrt(3.0), 'x', boundary_type='reflective')
+  top = openmc.ZPlane(z0=height, boundary_type='vacuum')
+  bottom = openmc.ZPlane(z0=0.0, boundary_type='vacuum')
+  main_cell = openmc.Cell(fill=hex_lattice, region=hex_prism & +bottom & -top)
+
+  model.geometry = openmc.Geometry([main_cell])
+
+  model.settings = openmc.Settings()
+  model.settings.batches = 10
+  model.settings.inactive = 5
+  model.settings.particles = particles
+  model.settings.temperature = {'default': T_inlet,
+                          'method': 'nearest',
+                          'range': (294.0, 3000.0),
+                          'tolerance': 1000.0}
+
+  lower_left = (-bundle_apothem, -bundle_apothem, 0.0)
+  upper_right = (bundle_apothem, bundle_apothem, height)
+  uniform_dist = openmc.stats.Box(lower_left, upper_right, only_fissionable=True)
+  model.settings.source = openmc.source.Source(space=uniform_dist)
+
+  return model
+
+def main():
+
+  ap = ArgumentParser()
+  ap.add_argument('-r', dest='n_rings', type=int, default=2,
+                  help='Number of rings of pins in the lattice')
+  ap.add_argument('-n', dest='n_layers', type=int, default=10,
+                  help='Number of axial layers')
+  ap.add_argument('-p', dest='particles', type=int, default=1000,
+                  help='Number of particles per batch')
+
+  args = ap.parse_args()
+
+  model = lattice(args.n_rings, args.n_layers, args.particles)
+  model.export_to_xml()
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,102 @@
+# Hexagonal lattice of pins for measuring how the OpenMC wrapping scales with the
+# number of cells and elements. The lattice size is set by n_rings and n_layers,
+# which must match the arguments given to make_openmc_model.py; the pin pattern
+# is generated by scripts/scaling_study.py and passed as Mesh/bundle/pattern.
+
+n_rings = 2
+n_layers = 10
+pin_pitch = 1.28
+height = 10.0
+
+[GlobalParams]
+  quad_center_elements = true
+[]
+
+[Mesh]
+  [pin]
+    type = PolygonConcentricCircleMeshGenerator
+    num_sides = 6
+    polygon_size = ${fparse pin_pitch / 2.0}
+    ring_radii = '${fparse 0.825 / 2.0} ${fparse 0.97 / 2.0}'
+    ring_intervals = '1 1'
+    num_sectors_per_side = '2 2 2 2 2 2'
+    ring_block_ids = '1 2'
+    background_block_ids = '3'
+  []
+  [bundle]
+    type = PatternedHexMeshGenerator
+    inputs = 'pin'
+    hexagon_size = ${fparse n_rings * pin_pitch}
+    pattern = '0 0;
+              0 0 0;
+               0 0'
+    rotate_angle = 0
+    background_block_id = '3'
+  []
+  [extrude]
+    type = FancyExtruderGenerator
+    input = bundle
+    heights = ${height}
+    num_layers = ${n_layers}
+    direction = '0 0 1'
+  []
+[]
+
+[Problem]
+  type = OpenMCCellAverageProblem
+  power = 1000.0
+  solid_blocks = '1 2 3'
+  tally_blocks = '1'
+  tally_type = cell
+  solid_cell_level = 1
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[Postprocessors]
+  [heat_source]
+    type = ElementIntegralVariablePostprocessor
+    variable = heat_source
+  []
+  [total_time]
+    type = PerfGraphData
+    section_name = 'Root'
+    data_type = TOTAL
+  []
+  [map_elems_to_cells]
+    type = CouplingTiming
+    section = mapElemsToCells
+    value_type = cumulative
+  []
+  [cache_contained_cells]
+    type = CouplingTiming
+    section = cacheContainedCells
+    value_type = cumulative
+  []
+  [send_temperature]
+    type = CouplingTiming
+    section = sendTemperatureToOpenMC
+    value_type = cumulative
+  []
+  [solve_openmc]
+    type = CouplingTiming
+    section = solveOpenMC
+    value_type = cumulative
+  []
+  [get_heat_source]
+    type = CouplingTiming
+    section = getHeatSourceFromOpenMC
+    value_type = cumulative
+  []
+  [max_memory]
+    type = CouplingMemory
+    structure = total
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,35 @@
+[Mesh]
+  type = NekRSMesh
+  order = SECOND
+  volume = true
+  parallel_type = replicated
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Problem]
+  type = NekRSProblem
+  casename = 'nekbox'
+  moving_mesh = true
+  minimize_transfers_in = true
+  deformation_tolerance = 1e-8
+[]
+
+[Executioner]
+  type = Transient
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
+
+[Postprocessors]
+  # The volume of the deformed cube is 2 * 2 * (2 + 0.1 * t)
+  [volume]
+    type = NekVolumeIntegral
+    field = unity
+  []
+[]
+
+[Outputs]
+  csv = true
+  hide = 'source_integral transfer_in heat_source'
+[]
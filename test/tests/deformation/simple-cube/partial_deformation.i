@@ -0,0 +1,97 @@
+# Only the half of the cube with x > 0 is stretched in the x-direction, so that the
+# elements with x < 0 never move and are skipped when sending the deformation to NekRS
+[Mesh]
+  type = FileMesh
+  file = box.msh
+  parallel_type = replicated
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [disp_x_o]
+    order = SECOND
+  []
+  [disp_y_o]
+    order = SECOND
+  []
+  [disp_z_o]
+    order = SECOND
+  []
+[]
+
+[Functions]
+  [fn_1]
+    type = ParsedFunction
+    value = 'if(x > 0, t*x*0.1, 0)'
+  []
+[]
+
+[AuxKernels]
+  [disp_x_calc]
+    type = FunctionAux
+    variable = disp_x_o
+    function = fn_1
+    execute_on = timestep_begin
+  []
+[]
+
+[Executioner]
+  type = Transient
+  end_time = 3
+  dt = 1
+[]
+
+[MultiApps]
+  [nek]
+    type = TransientMultiApp
+    app_type = CardinalApp
+    input_files = 'nek_partial.i'
+    execute_on = timestep_end
+    sub_cycling = true
+  []
+[]
+
+[Transfers]
+  [disp_x_to_nek]
+    type = MultiAppNearestNodeTransfer
+    source_variable = disp_x_o
+    direction = to_multiapp
+    multi_app = nek
+    variable = disp_x
+  []
+  [disp_y_to_nek]
+    type = MultiAppNearestNodeTransfer
+    source_variable = disp_y_o
+    direction = to_multiapp
+    multi_app = nek
+    variable = disp_y
+  []
+  [disp_z_to_nek]
+    type = MultiAppNearestNodeTransfer
+    source_variable = disp_z_o
+    direction = to_multiapp
+    multi_app = nek
+    variable = disp_z
+  []
+  [synchronize]
+    type = MultiAppPostprocessorTransfer
+    to_postprocessor = transfer_in
+    direction = to_multiapp
+    from_postprocessor = synchronize
+    multi_app = nek
+  []
+[]
+
+[Postprocessors]
+  [synchronize]
+    type = Receiver
+    default = 1
+  []
+[]
+
+[Outputs]
+  hide = 'synchronize'
+[]
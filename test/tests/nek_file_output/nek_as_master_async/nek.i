@@ -0,0 +1,21 @@
+[Problem]
+  type = NekRSProblem
+  casename = 'pyramid'
+
+  # write on every time step, with enough slots that several writes can be pending
+  asynchronous_fld_output = true
+  fld_output_queue_size = 3
+[]
+
+[Mesh]
+  type = NekRSMesh
+  boundary = '1 2 3 4 5 6 7 8'
+[]
+
+[Executioner]
+  type = Transient
+
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
@@ -0,0 +1,38 @@
+# The CFL number in this case is 4 * dt (see box.udf), so the time step size selected for
+# a target CFL number of 0.5 is 0.125. Starting from the time step of 0.02 in the .par file,
+# the time step doubles (the growth factor) until the target is reached. The output
+# synchronization time of 0.6 then shortens a step to 0.085, after which the time step
+# returns to 0.125 because the CFL number of the shortened step is rescaled to the
+# proposed time step.
+
+[Problem]
+  type = NekRSStandaloneProblem
+  casename = 'box'
+[]
+
+[Mesh]
+  type = NekRSMesh
+  volume = true
+[]
+
+[Executioner]
+  type = Transient
+
+  [TimeStepper]
+    type = NekTimeStepper
+    target_cfl = 0.5
+    growth_factor = 2.0
+  []
+[]
+
+[Postprocessors]
+  [dt]
+    type = TimestepSize
+    execute_on = timestep_end
+  []
+[]
+
+[Outputs]
+  csv = true
+  sync_times = '0.6'
+[]
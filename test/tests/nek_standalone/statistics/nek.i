@@ -0,0 +1,52 @@
+# The pressure is set to p(t) = t in the UDF, and 4 time steps of size 0.1 are taken.
+# Statistics are accumulated after t = 0.15, so the step ending at t = 0.2 contributes
+# over half a time step, and the steps ending at t = 0.3 and t = 0.4 over a full step.
+# At t = 0.4, the time-weighted statistics are:
+#
+#   mean = (0.2 * 0.05 + 0.3 * 0.1 + 0.4 * 0.1) / 0.25 = 0.32
+#   rms  = sqrt((0.2^2 * 0.05 + 0.3^2 * 0.1 + 0.4^2 * 0.1) / 0.25 - 0.32^2) = sqrt(0.0056)
+#   min  = 0.2 (the step ending at t = 0.1 is excluded)
+#   max  = 0.4
+
+[Problem]
+  type = NekRSStandaloneProblem
+  casename = 'pyramid'
+  statistics = 'pressure'
+  statistics_start_time = 0.15
+[]
+
+[Mesh]
+  type = NekRSMesh
+  volume = true
+[]
+
+[Executioner]
+  type = Transient
+
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
+
+[Postprocessors]
+  [P_mean]
+    type = ElementAverageValue
+    variable = P_mean
+  []
+  [P_rms]
+    type = ElementAverageValue
+    variable = P_rms
+  []
+  [P_min]
+    type = ElementAverageValue
+    variable = P_min
+  []
+  [P_max]
+    type = ElementAverageValue
+    variable = P_max
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,39 @@
+# The x-velocity is set to u(t) = 1e8 + t in the UDF, so the statistics are the same as
+# those of the pressure in nek.i, but offset by 1e8 for the mean, minimum, and maximum.
+# Computing the RMS from the mean square would lose all precision here, since the
+# variance of 0.0056 is far below the round-off in the mean square of ~1e16.
+
+[Problem]
+  type = NekRSStandaloneProblem
+  casename = 'pyramid'
+  statistics = 'velocity'
+  statistics_start_time = 0.15
+[]
+
+[Mesh]
+  type = NekRSMesh
+  volume = true
+[]
+
+[Executioner]
+  type = Transient
+
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
+
+[Postprocessors]
+  [vel_x_mean]
+    type = ElementAverageValue
+    variable = vel_x_mean
+  []
+  [vel_x_rms]
+    type = ElementAverageValue
+    variable = vel_x_rms
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,89 @@
+[Mesh]
+  [sphere]
+    type = FileMeshGenerator
+    file = ../../neutronics/meshes/sphere.e
+  []
+  [solid]
+    type = CombinerGenerator
+    inputs = sphere
+    positions = '0 0 0
+                 0 0 4
+                 0 0 8'
+  []
+  [solid_ids]
+    type = SubdomainIDGenerator
+    input = solid
+    subdomain_id = '100'
+  []
+
+  parallel_type = replicated
+[]
+
+# This AuxVariable and AuxKernel is only here to get the postprocessors
+# to evaluate correctly. This can be deleted after MOOSE issue #17534 is fixed.
+[AuxVariables]
+  [dummy]
+  []
+[]
+
+[AuxKernels]
+  [dummy]
+    type = ConstantAux
+    variable = dummy
+    value = 0.0
+  []
+[]
+
+[Problem]
+  type = OpenMCCellAverageProblem
+  power = 100.0
+  solid_blocks = '100'
+  tally_blocks = '100'
+  solid_cell_level = 0
+  tally_type = cell
+  check_tally_sum = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[Postprocessors]
+  # every rank maps all 768 elements, each to an (index, instance) pair of 4-byte
+  # integers with a 4-byte phase, for 768 * 12 = 9216 bytes
+  [elem_to_cell]
+    type = CouplingMemory
+    structure = elem_to_cell
+  []
+
+  # the sizes of the maps, and of the solution on each rank, depend on the standard
+  # library and the number of ranks, so are not output
+  [cell_to_elem]
+    type = CouplingMemory
+    structure = cell_to_elem
+    value_type = sum
+    outputs = none
+  []
+  [contained_cells]
+    type = CouplingMemory
+    structure = contained_cells
+    value_type = min
+    outputs = none
+  []
+  [serialized_solution]
+    type = CouplingMemory
+    structure = serialized_solution
+    outputs = none
+  []
+  [total]
+    type = CouplingMemory
+    structure = total
+    value_type = sum
+    outputs = none
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,104 @@
+[Mesh]
+  [sphere]
+    type = FileMeshGenerator
+    file = ../../neutronics/meshes/sphere.e
+  []
+  [solid]
+    type = CombinerGenerator
+    inputs = sphere
+    positions = '0 0 0
+                 0 0 4
+                 0 0 8'
+  []
+  [solid_ids]
+    type = SubdomainIDGenerator
+    input = solid
+    subdomain_id = '100'
+  []
+
+  parallel_type = replicated
+[]
+
+# This AuxVariable and AuxKernel is only here to get the postprocessors
+# to evaluate correctly. This can be deleted after MOOSE issue #17534 is fixed.
+[AuxVariables]
+  [dummy]
+  []
+[]
+
+[AuxKernels]
+  [dummy]
+    type = ConstantAux
+    variable = dummy
+    value = 0.0
+  []
+[]
+
+[Problem]
+  type = OpenMCCellAverageProblem
+  power = 100.0
+  solid_blocks = '100'
+  tally_blocks = '100'
+  solid_cell_level = 0
+  tally_type = cell
+  check_tally_sum = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[Postprocessors]
+  # the wall times vary from run to run, so are not output
+  [map_elems_to_cells]
+    type = CouplingTiming
+    section = mapElemsToCells
+    value_type = cumulative
+    outputs = none
+  []
+  [send_temperature]
+    type = CouplingTiming
+    section = sendTemperatureToOpenMC
+    outputs = none
+  []
+  [heat_source]
+    type = CouplingTiming
+    section = getHeatSourceFromOpenMC
+    rank_value = average
+    outputs = none
+  []
+  [solve]
+    type = CouplingTiming
+    section = 'OpenMCCellAverageProblem::solveOpenMC'
+    outputs = none
+  []
+
+  # the elements are mapped to cells once, because all the cells are filled with materials,
+  # while the data is transferred and OpenMC is run once per time step
+  [map_elems_to_cells_calls]
+    type = CouplingTiming
+    section = mapElemsToCells
+    value_type = calls
+  []
+  [send_temperature_calls]
+    type = CouplingTiming
+    section = sendTemperatureToOpenMC
+    value_type = calls
+  []
+  [heat_source_calls]
+    type = CouplingTiming
+    section = getHeatSourceFromOpenMC
+    value_type = calls
+    rank_value = average
+  []
+  [solve_calls]
+    type = CouplingTiming
+    section = 'OpenMCCellAverageProblem::solveOpenMC'
+    value_type = calls
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
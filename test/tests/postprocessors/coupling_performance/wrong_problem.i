@@ -0,0 +1,20 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Postprocessors]
+  [total]
+    type = CouplingMemory
+    structure = total
+  []
+[]
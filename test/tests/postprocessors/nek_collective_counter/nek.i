@@ -0,0 +1,50 @@
+[Problem]
+  type = NekRSProblem
+[]
+
+[Mesh]
+  type = NekRSMesh
+  volume = true
+[]
+
+[Executioner]
+  type = Transient
+
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
+
+[Outputs]
+  csv = true
+
+  # the bytes depend on the number of ranks, and the times vary from run to run
+  hide = 'source_integral allgather_bytes allgatherv_time total_time'
+[]
+
+[Postprocessors]
+  # Building the mesh mirror issues two allreduces (for the total number of NekRS elements
+  # and the number of coupled elements), and each heat source transfer issues one more (for
+  # the integral of the heat source, which is zero so that no normalization is needed).
+  # There are no other Nek postprocessors, so that no other reductions are issued.
+  [allreduce_calls]
+    type = NekCollectiveCounter
+    collective = allreduce
+    value_type = calls
+  []
+  [allgather_bytes]
+    type = NekCollectiveCounter
+    collective = allgather
+    value_type = bytes
+  []
+  [allgatherv_time]
+    type = NekCollectiveCounter
+    collective = allgatherv
+    value_type = time
+    rank_value = average
+  []
+  [total_time]
+    type = NekCollectiveCounter
+    value_type = time
+  []
+[]
@@ -0,0 +1,61 @@
+[Problem]
+  type = NekRSProblem
+  casename = 'cube'
+[]
+
+[Mesh]
+  type = NekRSMesh
+  boundary = '1 2 3 4 5 6'
+[]
+
+[Executioner]
+  type = Transient
+
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
+
+[Outputs]
+  [out]
+    type = CSV
+    hide = 'flux_integral'
+    execute_on = 'final'
+  []
+[]
+
+# The temperature is T = x + 2y + 4z and the conductivity is k = 1 + y^2 on the box
+# [-1, 1] x [-1, 1] x [0, 2]. Both are exactly represented on the GLL points, so the
+# heat flux -k * grad(T) . n integrated over each boundary has the exact values:
+#   boundary 1 (z = 2):  -64/3
+#   boundary 2 (x = 1):  -16/3
+#   boundary 3 (z = 0):   64/3
+#   boundary 4 (x = -1):  16/3
+#   boundary 5 (y = 1):  -16
+#   boundary 6 (y = -1):  16
+[Postprocessors]
+  [flux_side1]
+    type = NekHeatFluxIntegral
+    boundary = '1'
+  []
+  [flux_side2]
+    type = NekHeatFluxIntegral
+    boundary = '2'
+  []
+  [flux_side3]
+    type = NekHeatFluxIntegral
+    boundary = '3'
+  []
+  [flux_side4]
+    type = NekHeatFluxIntegral
+    boundary = '4'
+  []
+  [flux_side5]
+    type = NekHeatFluxIntegral
+    boundary = '5'
+  []
+  [flux_side6]
+    type = NekHeatFluxIntegral
+    boundary = '6'
+  []
+[]
@@ -0,0 +1,52 @@
+[Problem]
+  type = NekRSProblem
+  min_T = min_T
+  max_T = max_T
+[]
+
+[Mesh]
+  type = NekRSMesh
+  volume = true
+[]
+
+[Executioner]
+  type = Transient
+
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
+
+[Outputs]
+  csv = true
+  hide = 'min_T max_T source_integral'
+[]
+
+[Postprocessors]
+  # The limits are above the initial temperature everywhere, so that every GLL point is
+  # limited on the first time step. The temperature is not solved for, so on the second
+  # time step the temperature already sits at the minimum and no points are limited.
+  [min_T]
+    type = Receiver
+    default = 1e5
+  []
+  [max_T]
+    type = Receiver
+    default = 2e5
+  []
+  [limited]
+    type = NekLimitedTemperaturePoints
+  []
+  [min_temp]
+    type = NekVolumeExtremeValue
+    field = temperature
+    value_type = min
+    execute_on = timestep_end
+  []
+  [max_temp]
+    type = NekVolumeExtremeValue
+    field = temperature
+    value_type = max
+    execute_on = timestep_end
+  []
+[]
@@ -0,0 +1,102 @@
+# The master application sends a spatially uniform heat source equal to the time to NekRS,
+# which sub-cycles four time steps per master time step. With interpolate_transfers_in, the
+# source applied by NekRS on each sub-cycled step should equal the NekRS time (once two
+# states have been received); otherwise, it is held at the value from the end of the master
+# application's time step.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 4
+  ny = 4
+  nz = 4
+  xmin = -1.0
+  xmax = 1.0
+  ymin = -1.0
+  ymax = 1.0
+  zmin = -1.0
+  zmax = 1.0
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [source]
+  []
+[]
+
+[Functions]
+  [source]
+    type = ParsedFunction
+    value = 't'
+  []
+[]
+
+[AuxKernels]
+  [source]
+    type = FunctionAux
+    variable = source
+    function = source
+    execute_on = 'initial timestep_begin'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 0.2
+[]
+
+[MultiApps]
+  [nek]
+    type = TransientMultiApp
+    app_type = CardinalApp
+    input_files = 'nek.i'
+    execute_on = timestep_end
+    sub_cycling = true
+    output_sub_cycles = true
+  []
+[]
+
+[Transfers]
+  [source]
+    type = MultiAppNearestNodeTransfer
+    source_variable = source
+    direction = to_multiapp
+    multi_app = nek
+    variable = heat_source
+  []
+  [source_integral]
+    type = MultiAppPostprocessorTransfer
+    to_postprocessor = source_integral
+    direction = to_multiapp
+    from_postprocessor = source_integral
+    multi_app = nek
+  []
+  [synchronization]
+    type = MultiAppPostprocessorTransfer
+    to_postprocessor = transfer_in
+    direction = to_multiapp
+    from_postprocessor = synchronization_in
+    multi_app = nek
+  []
+[]
+
+[Postprocessors]
+  [source_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = source
+    execute_on = 'initial timestep_begin'
+  []
+  [synchronization_in]
+    type = Receiver
+    default = 1.0
+  []
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  hide = 'synchronization_in'
+[]
@@ -0,0 +1,32 @@
+[Problem]
+  type = NekRSProblem
+  casename = 'cube'
+  minimize_transfers_in = true
+  interpolate_transfers_in = true
+[]
+
+[Mesh]
+  type = NekRSMesh
+  volume = true
+[]
+
+[Executioner]
+  type = Transient
+
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
+
+[Postprocessors]
+  # the heat source applied by NekRS on each time step, which the UDF copies into the pressure
+  [applied_source]
+    type = NekVolumeAverage
+    field = pressure
+  []
+[]
+
+[Outputs]
+  csv = true
+  hide = 'source_integral transfer_in'
+[]
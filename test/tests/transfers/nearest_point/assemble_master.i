@@ -0,0 +1,147 @@
+# This problem checks that values from several sub-apps are assembled into the master
+# receiver. Each sub-app holds two pebbles, at (0, 0, 0) and (0, 5, 0) in its own frame,
+# and is positioned away from the master's origin. The value of g is constant in each
+# pebble, equal to 1, 2, and 3 in the first pebble of each sub-app, and 10 higher in the
+# second. Each receiver position in the master must be shifted into the frame of its
+# sub-app to find the correct pebble, so that the master should receive 1, 11, 2, 12, 3,
+# and 13, regardless of how the sub-apps are distributed across ranks.
+
+[Mesh]
+  [sphere]
+    type = FileMeshGenerator
+    file = sphere.e
+  []
+  [combiner]
+    type = CombinerGenerator
+    inputs = sphere
+    positions = '0 -5 0
+                 0 0 0
+                 10 -5 0
+                 10 0 0
+                 20 -5 2
+                 20 0 2'
+  []
+[]
+
+[Variables]
+  [temp]
+    initial_condition = 300
+  []
+[]
+
+[AuxVariables]
+  [average_g_master]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[Kernels]
+  [hc]
+    type = Diffusion
+    variable = temp
+  []
+[]
+
+[BCs]
+  [outside]
+    type = DirichletBC
+    variable = temp
+    boundary = '1'
+    value = 300
+  []
+[]
+
+[UserObjects]
+  [average_g_master]
+    type = NearestPointReceiver
+    positions = '0 -5 0
+                 0 0 0
+                 10 -5 0
+                 10 0 0
+                 20 -5 2
+                 20 0 2'
+  []
+[]
+
+[AuxKernels]
+  [average_g_master]
+    type = SpatialUserObjectAux
+    variable = average_g_master
+    user_object = average_g_master
+  []
+[]
+
+[Postprocessors]
+  [g0]
+    type = PointValue
+    variable = average_g_master
+    point = '0 -5 0'
+  []
+  [g1]
+    type = PointValue
+    variable = average_g_master
+    point = '0 0 0'
+  []
+  [g2]
+    type = PointValue
+    variable = average_g_master
+    point = '10 -5 0'
+  []
+  [g3]
+    type = PointValue
+    variable = average_g_master
+    point = '10 0 0'
+  []
+  [g4]
+    type = PointValue
+    variable = average_g_master
+    point = '20 -5 2'
+  []
+  [g5]
+    type = PointValue
+    variable = average_g_master
+    point = '20 0 2'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  dt = 0.1
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-6
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = 'timestep_end'
+  []
+[]
+
+[MultiApps]
+  [sub]
+    type = TransientMultiApp
+    app_type = CardinalApp
+    input_files = 'assemble_sub.i'
+    positions = '0 -5 0
+                 10 -5 0
+                 20 -5 2'
+    cli_args = 'Functions/g/vals=1;Functions/g/vals=2;Functions/g/vals=3'
+    execute_on = timestep_begin
+  []
+[]
+
+[Transfers]
+  [average_g_from_sub]
+    type = NearestPointReceiverTransfer
+    direction = from_multiapp
+    multi_app = sub
+    from_uo = average_g_sub
+    to_uo = average_g_master
+    assemble_from_sub_apps = true
+  []
+[]
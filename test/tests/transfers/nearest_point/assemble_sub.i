@@ -0,0 +1,72 @@
+[Mesh]
+  [sphere]
+    type = FileMeshGenerator
+    file = sphere.e
+  []
+  [combiner]
+    type = CombinerGenerator
+    inputs = sphere
+    positions = '0 0 0
+                 0 5 0'
+  []
+[]
+
+[Variables]
+  [temp]
+    initial_condition = 300
+  []
+[]
+
+[AuxVariables]
+  [g]
+  []
+[]
+
+[ICs]
+  [g]
+    type = FunctionIC
+    variable = g
+    function = g
+  []
+[]
+
+[Functions]
+  # constant in each pebble, and 10 higher in the pebble at (0, 5, 0)
+  [g]
+    type = ParsedFunction
+    value = 'base + if(y > 2.5, 10, 0)'
+    vars = 'base'
+    vals = 0
+  []
+[]
+
+[UserObjects]
+  [average_g_sub] # This computes the average that will be transferred to master
+    type = CardinalNearestPointAverage
+    variable = g
+    points = '0 0 0
+              0 5 0'
+    execute_on = 'initial timestep_end'
+  []
+[]
+
+[Kernels]
+  [hc]
+    type = Diffusion
+    variable = temp
+  []
+[]
+
+[BCs]
+  [outside]
+    type = DirichletBC
+    variable = temp
+    boundary = '1'
+    value = 300
+  []
+[]
+
+[Executioner]
+  type = Transient
+  nl_abs_tol = 1e-6
+[]
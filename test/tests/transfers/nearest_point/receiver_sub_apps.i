@@ -0,0 +1,148 @@
+# This problem checks that values from several sub-apps are assembled into the master
+# receiver when the sub-app of each receiver position is given explicitly. The sub-apps are
+# the same as in assemble_master.i, but the second sub-app is positioned at (4, 0, 0), so
+# that the second pebble of the first sub-app, at (0, 0, 0), is closer to the position of
+# the second sub-app than to that of its own. Taking the value from the sub-app positioned
+# nearest to each receiver position would give 2 at (0, 0, 0); with the explicit sub-apps,
+# the master should receive 1, 11, 2, 12, 3, and 13.
+
+[Mesh]
+  [sphere]
+    type = FileMeshGenerator
+    file = sphere.e
+  []
+  [combiner]
+    type = CombinerGenerator
+    inputs = sphere
+    positions = '0 -5 0
+                 0 0 0
+                 4 0 0
+                 4 5 0
+                 20 -5 2
+                 20 0 2'
+  []
+[]
+
+[Variables]
+  [temp]
+    initial_condition = 300
+  []
+[]
+
+[AuxVariables]
+  [average_g_master]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[Kernels]
+  [hc]
+    type = Diffusion
+    variable = temp
+  []
+[]
+
+[BCs]
+  [outside]
+    type = DirichletBC
+    variable = temp
+    boundary = '1'
+    value = 300
+  []
+[]
+
+[UserObjects]
+  [average_g_master]
+    type = NearestPointReceiver
+    positions = '0 -5 0
+                 0 0 0
+                 4 0 0
+                 4 5 0
+                 20 -5 2
+                 20 0 2'
+  []
+[]
+
+[AuxKernels]
+  [average_g_master]
+    type = SpatialUserObjectAux
+    variable = average_g_master
+    user_object = average_g_master
+  []
+[]
+
+[Postprocessors]
+  [g0]
+    type = PointValue
+    variable = average_g_master
+    point = '0 -5 0'
+  []
+  [g1]
+    type = PointValue
+    variable = average_g_master
+    point = '0 0 0'
+  []
+  [g2]
+    type = PointValue
+    variable = average_g_master
+    point = '4 0 0'
+  []
+  [g3]
+    type = PointValue
+    variable = average_g_master
+    point = '4 5 0'
+  []
+  [g4]
+    type = PointValue
+    variable = average_g_master
+    point = '20 -5 2'
+  []
+  [g5]
+    type = PointValue
+    variable = average_g_master
+    point = '20 0 2'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  dt = 0.1
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-6
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = 'timestep_end'
+  []
+[]
+
+[MultiApps]
+  [sub]
+    type = TransientMultiApp
+    app_type = CardinalApp
+    input_files = 'assemble_sub.i'
+    positions = '0 -5 0
+                 4 0 0
+                 20 -5 2'
+    cli_args = 'Functions/g/vals=1;Functions/g/vals=2;Functions/g/vals=3'
+    execute_on = timestep_begin
+  []
+[]
+
+[Transfers]
+  [average_g_from_sub]
+    type = NearestPointReceiverTransfer
+    direction = from_multiapp
+    multi_app = sub
+    from_uo = average_g_sub
+    to_uo = average_g_master
+    assemble_from_sub_apps = true
+    receiver_sub_apps = '0 0 1 1 2 2'
+  []
+[]
@@ -0,0 +1,203 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <vector>
+
+/**
+ * A small microbenchmark harness in the style of Google Benchmark, so that the benchmark
+ * executable does not need any libraries beyond those already used by the unit tests.
+ * A benchmark is a function which sets up its problem for a given size and then times
+ * its kernel in a 'while (state.keepRunning())' loop:
+ *
+ *   static void myKernel(microbenchmark::State & state)
+ *   {
+ *     // setup for a problem of size state.range()
+ *     while (state.keepRunning())
+ *       microbenchmark::doNotOptimize(kernel());
+ *   }
+ *   CARDINAL_BENCHMARK(myKernel, 10, 100, 1000);
+ */
+namespace microbenchmark
+{
+
+/// Timing state for one run of a benchmark at one problem size
+class State
+{
+public:
+  /**
+   * @param[in] range problem size
+   * @param[in] min_time minimum time (seconds) to spend timing the benchmark
+   */
+  State(const int range, const double min_time) : _range(range), _min_time(min_time) {}
+
+  /**
+   * Whether to run another iteration of the timed loop; iterations are run in batches
+   * of doubling size so that the clocks are only read between batches
+   * @return whether to keep running
+   */
+  bool keepRunning()
+  {
+    if (_remaining > 0)
+    {
+      --_remaining;
+      return true;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    std::clock_t cpu_now = std::clock();
+
+    if (!_started)
+    {
+      _started = true;
+      _start = now;
+      _cpu_start = cpu_now;
+      _batch = 1;
+      _remaining = 0;
+      return true;
+    }
+
+    _iterations += _batch;
+    _real_time = std::chrono::duration<double>(now - _start).count();
+    _cpu_time = static_cast<double>(cpu_now - _cpu_start) / CLOCKS_PER_SEC;
+
+    if (_real_time >= _min_time)
+      return false;
+
+    _batch *= 2;
+    _remaining = _batch - 1;
+    return true;
+  }
+
+  /**
+   * Problem size
+   * @return problem size
+   */
+  int range() const { return _range; }
+
+  /**
+   * Set the number of items (such as points) processed per iteration, to report a throughput
+   * @param[in] items items processed per iteration
+   */
+  void setItemsPerIteration(const long items) { _items_per_iteration = items; }
+
+  /// Total number of timed iterations
+  long iterations() const { return _iterations; }
+
+  /// Total wall time of the timed iterations (seconds)
+  double realTime() const { return _real_time; }
+
+  /// Total CPU time of the timed iterations (seconds)
+  double cpuTime() const { return _cpu_time; }
+
+  /// Items processed per iteration
+  long itemsPerIteration() const { return _items_per_iteration; }
+
+protected:
+  /// Problem size
+  const int _range;
+
+  /// Minimum time to spend timing
+  const double _min_time;
+
+  /// Whether timing has started
+  bool _started = false;
+
+  /// Iterations left in the current batch
+  long _remaining = 0;
+
+  /// Size of the current batch
+  long _batch = 0;
+
+  /// Iterations in completed batches
+  long _iterations = 0;
+
+  /// Items processed per iteration
+  long _items_per_iteration = 0;
+
+  /// Wall time of the completed batches
+  double _real_time = 0.0;
+
+  /// CPU time of the completed batches
+  double _cpu_time = 0.0;
+
+  /// Wall clock at the start of timing
+  std::chrono::steady_clock::time_point _start;
+
+  /// CPU clock at the start of timing
+  std::clock_t _cpu_start;
+};
+
+/// A registered benchmark, run once for each problem size
+struct Benchmark
+{
+  /// name
+  std::string name;
+
+  /// benchmark function
+  void (*function)(State &);
+
+  /// problem sizes
+  std::vector<int> ranges;
+};
+
+/**
+ * Get all registered benchmarks
+ * @return benchmarks
+ */
+inline std::vector<Benchmark> &
+registry()
+{
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+/**
+ * Register a benchmark
+ * @param[in] name name
+ * @param[in] function benchmark function
+ * @param[in] ranges problem sizes
+ * @return true, so that registration can initialize a static variable
+ */
+inline bool
+registerBenchmark(const std::string & name, void (*function)(State &), const std::vector<int> & ranges)
+{
+  registry().push_back({name, function, ranges});
+  return true;
+}
+
+/**
+ * Prevent the compiler from optimizing away a value computed in a benchmark
+ * @param[in] value value
+ */
+template <typename T>
+inline void
+doNotOptimize(const T & value)
+{
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+} // namespace microbenchmark
+
+#define CARDINAL_BENCHMARK(function, ...)                                                          \
+  static const bool function##_registered =                                                        \
+      microbenchmark::registerBenchmark(#function, function, {__VA_ARGS__})